@@ -0,0 +1,232 @@
+#pragma once
+#include <cstddef>
+#include <new>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// Специализированные аллокаторы для Vector/RawMemory. Благодаря allocator-aware
+// дизайну подключаются одним шаблонным параметром, слой Vector их не замечает.
+
+// Аллокатор с заданным выравниванием: 64 — под кеш-линию, 4096 — под страницу.
+// Полезен для сканирующих и SIMD-нагрузок, где выравнивание буфера решает
+template <typename T, size_t Align>
+struct AlignedAllocator {
+    static_assert((Align & (Align - 1)) == 0, "Выравнивание должно быть степенью двойки");
+    static_assert(Align >= alignof(T), "Выравнивание не может быть меньше естественного");
+
+    using value_type = T;
+
+    template <typename U>
+    struct rebind {
+        using other = AlignedAllocator<U, Align>;
+    };
+
+    AlignedAllocator() = default;
+    template <typename U>
+    AlignedAllocator(const AlignedAllocator<U, Align>&) noexcept {
+    }
+
+    T* allocate(size_t n) {
+        return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t{Align}));
+    }
+
+    void deallocate(T* p, size_t /*n*/) noexcept {
+        ::operator delete(p, std::align_val_t{Align});
+    }
+};
+
+template <typename T, typename U, size_t Align>
+bool operator==(const AlignedAllocator<T, Align>&, const AlignedAllocator<U, Align>&) noexcept {
+    return true;
+}
+template <typename T, typename U, size_t Align>
+bool operator!=(const AlignedAllocator<T, Align>&, const AlignedAllocator<U, Align>&) noexcept {
+    return false;
+}
+
+// Аллокатор для многогигабайтных буферов: блоки от 2 МиБ выделяются целыми
+// страницами через mmap с просьбой о больших страницах (THP), мелкие — как обычно.
+// Сокращает TLB-промахи при потоковом чтении больших векторов
+template <typename T>
+struct HugePageAllocator {
+    static constexpr size_t kHugePageBytes = size_t{2} << 20;
+
+    using value_type = T;
+
+    HugePageAllocator() = default;
+    template <typename U>
+    HugePageAllocator(const HugePageAllocator<U>&) noexcept {
+    }
+
+    T* allocate(size_t n) {
+        const size_t bytes = n * sizeof(T);
+        if (!UsesMmap(bytes)) {
+            return static_cast<T*>(::operator new(bytes));
+        }
+#if defined(__linux__)
+        void* p = ::mmap(nullptr, RoundToHugePage(bytes), PROT_READ | PROT_WRITE,
+            MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (p == MAP_FAILED) {
+            throw std::bad_alloc{};
+        }
+#if defined(MADV_HUGEPAGE)
+        // Совет, а не требование: без поддержки THP просто останутся обычные страницы
+        ::madvise(p, RoundToHugePage(bytes), MADV_HUGEPAGE);
+#endif
+        return static_cast<T*>(p);
+#else
+        return static_cast<T*>(::operator new(bytes));
+#endif
+    }
+
+    void deallocate(T* p, size_t n) noexcept {
+        const size_t bytes = n * sizeof(T);
+        if (!UsesMmap(bytes)) {
+            ::operator delete(p);
+            return;
+        }
+#if defined(__linux__)
+        ::munmap(p, RoundToHugePage(bytes));
+#else
+        ::operator delete(p);
+#endif
+    }
+
+private:
+    static bool UsesMmap(size_t bytes) noexcept {
+#if defined(__linux__)
+        return bytes >= kHugePageBytes;
+#else
+        (void)bytes;
+        return false;
+#endif
+    }
+
+    static size_t RoundToHugePage(size_t bytes) noexcept {
+        return (bytes + kHugePageBytes - 1) / kHugePageBytes * kHugePageBytes;
+    }
+};
+
+template <typename T, typename U>
+bool operator==(const HugePageAllocator<T>&, const HugePageAllocator<U>&) noexcept {
+    return true;
+}
+template <typename T, typename U>
+bool operator!=(const HugePageAllocator<T>&, const HugePageAllocator<U>&) noexcept {
+    return false;
+}
+
+// Политика размещения страниц вектора по NUMA-узлам.
+// FirstTouch — страницы достаются узлу потока, который первым их тронет;
+// в паре с параллельной инициализацией Vector(size_t) это раскладывает
+// буфер по узлам будущих читателей само собой.
+// Bind — весь буфер прибивается к заданному узлу.
+// Interleave — страницы раскладываются по всем узлам по кругу: для буферов,
+// которые читают оба сокета, выравнивает пропускную способность
+enum class NumaPolicy {
+    FirstTouch,
+    Bind,
+    Interleave,
+};
+
+// NUMA-аллокатор: крупные блоки выделяются mmap и привязываются к узлам
+// через mbind; мелкие идут через operator new, где политика не окупается.
+// mbind — совет планировщику памяти: на одноузловой машине или при недоступном
+// системном вызове аллокатор молча откатывается к обычному размещению
+template <typename T>
+struct NumaAllocator {
+    static constexpr size_t kMmapThresholdBytes = size_t{1} << 20;
+
+    using value_type = T;
+
+    NumaAllocator() = default;
+    explicit NumaAllocator(NumaPolicy policy, int node = 0) noexcept
+        : policy(policy)
+        , node(node) {
+    }
+    template <typename U>
+    NumaAllocator(const NumaAllocator<U>& other) noexcept
+        : policy(other.policy)
+        , node(other.node) {
+    }
+
+    T* allocate(size_t n) {
+        const size_t bytes = n * sizeof(T);
+        if (!UsesMmap(bytes)) {
+            return static_cast<T*>(::operator new(bytes));
+        }
+#if defined(__linux__)
+        void* p = ::mmap(nullptr, RoundToPage(bytes), PROT_READ | PROT_WRITE,
+            MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (p == MAP_FAILED) {
+            throw std::bad_alloc{};
+        }
+        BindPages(p, RoundToPage(bytes));
+        return static_cast<T*>(p);
+#else
+        return static_cast<T*>(::operator new(bytes));
+#endif
+    }
+
+    void deallocate(T* p, size_t n) noexcept {
+        const size_t bytes = n * sizeof(T);
+        if (!UsesMmap(bytes)) {
+            ::operator delete(p);
+            return;
+        }
+#if defined(__linux__)
+        ::munmap(p, RoundToPage(bytes));
+#else
+        ::operator delete(p);
+#endif
+    }
+
+    NumaPolicy policy = NumaPolicy::FirstTouch;
+    int node = 0;
+
+private:
+    static bool UsesMmap(size_t bytes) noexcept {
+#if defined(__linux__)
+        return bytes >= kMmapThresholdBytes;
+#else
+        (void)bytes;
+        return false;
+#endif
+    }
+
+    static size_t RoundToPage(size_t bytes) noexcept {
+        const size_t kPageBytes = 4096;
+        return (bytes + kPageBytes - 1) / kPageBytes * kPageBytes;
+    }
+
+    void BindPages(void* p, size_t bytes) const noexcept {
+#if defined(__linux__) && defined(SYS_mbind)
+        // Значения MPOL_* из <numaif.h>; сам заголовок есть только с libnuma
+        constexpr int kMpolBind = 2;
+        constexpr int kMpolInterleave = 3;
+        if (policy == NumaPolicy::FirstTouch) {
+            return;
+        }
+        const int mode = policy == NumaPolicy::Bind ? kMpolBind : kMpolInterleave;
+        unsigned long nodemask = policy == NumaPolicy::Bind ? 1ul << node : ~0ul;
+        // Ошибку игнорируем: без NUMA страницы просто останутся локальными
+        ::syscall(SYS_mbind, p, bytes, mode, &nodemask, sizeof(nodemask) * 8 + 1, 0u);
+#else
+        (void)p;
+        (void)bytes;
+#endif
+    }
+};
+
+template <typename T, typename U>
+bool operator==(const NumaAllocator<T>& lhs, const NumaAllocator<U>& rhs) noexcept {
+    return lhs.policy == rhs.policy && lhs.node == rhs.node;
+}
+template <typename T, typename U>
+bool operator!=(const NumaAllocator<T>& lhs, const NumaAllocator<U>& rhs) noexcept {
+    return !(lhs == rhs);
+}
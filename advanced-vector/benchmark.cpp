@@ -0,0 +1,215 @@
+// Микробенчмарки Vector против std::vector по горячим операциям.
+// Сборка: g++ -std=c++17 -O2 -DNDEBUG -pthread benchmark.cpp -o benchmark
+// Вывод — наносекунды на элемент, чтобы регрессии были видны невооружённым глазом.
+#include "vector.h"
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace {
+
+// Тип с nothrow-перемещением, но нетривиальный (строка в куче)
+struct Movable {
+    Movable() = default;
+    explicit Movable(int id)
+        : id(id)
+        , payload(16, 'x') {
+    }
+    Movable(const Movable&) = default;
+    Movable& operator=(const Movable&) = default;
+    Movable(Movable&&) noexcept = default;
+    Movable& operator=(Movable&&) noexcept = default;
+
+    int id = 0;
+    std::string payload;
+};
+
+// Тип только с копированием — проверяет копирующую ветку реаллокации
+struct CopyOnly {
+    CopyOnly() = default;
+    explicit CopyOnly(int id)
+        : id(id) {
+    }
+    CopyOnly(const CopyOnly&) = default;
+    CopyOnly& operator=(const CopyOnly&) = default;
+    CopyOnly(CopyOnly&&) = delete;
+    CopyOnly& operator=(CopyOnly&&) = delete;
+
+    int id = 0;
+};
+
+using Clock = std::chrono::steady_clock;
+
+// Не даёт оптимизатору выбросить результат измеряемой операции
+template <typename T>
+void DoNotOptimize(const T& value) {
+    asm volatile("" : : "g"(&value) : "memory");
+}
+
+// Прогоняет fn несколько раз и возвращает лучшие наносекунды на элемент
+template <typename Fn>
+double BenchNsPerElem(size_t n, const Fn& fn) {
+    const int kRuns = 5;
+    double best = 1e100;
+    for (int run = 0; run < kRuns; ++run) {
+        const auto start = Clock::now();
+        fn();
+        const auto stop = Clock::now();
+        const double ns = std::chrono::duration<double, std::nano>(stop - start).count();
+        best = std::min(best, ns / static_cast<double>(n));
+    }
+    return best;
+}
+
+void Report(const char* name, double ours, double theirs) {
+    std::printf("%-34s %10.2f %12.2f %8.2fx\n", name, ours, theirs,
+        theirs > 0 ? ours / theirs : 0.0);
+}
+
+template <typename T>
+T MakeElem(int i) {
+    if constexpr (std::is_same_v<T, int>) {
+        return i;
+    }
+    else {
+        return T(i);
+    }
+}
+
+template <typename T>
+void BenchPushBackGrowth(const char* label, size_t n) {
+    const double ours = BenchNsPerElem(n, [n] {
+        Vector<T> v;
+        for (size_t i = 0; i < n; ++i) {
+            const T elem = MakeElem<T>(static_cast<int>(i));
+            v.PushBack(elem);
+        }
+    });
+    const double theirs = BenchNsPerElem(n, [n] {
+        std::vector<T> v;
+        for (size_t i = 0; i < n; ++i) {
+            const T elem = MakeElem<T>(static_cast<int>(i));
+            v.push_back(elem);
+        }
+    });
+    Report(label, ours, theirs);
+}
+
+template <typename T>
+void BenchEmplaceMiddle(const char* label, size_t n) {
+    const double ours = BenchNsPerElem(n, [n] {
+        Vector<T> v;
+        for (size_t i = 0; i < n; ++i) {
+            v.Emplace(v.begin() + v.Size() / 2, static_cast<int>(i));
+        }
+    });
+    const double theirs = BenchNsPerElem(n, [n] {
+        std::vector<T> v;
+        for (size_t i = 0; i < n; ++i) {
+            v.emplace(v.begin() + v.size() / 2, static_cast<int>(i));
+        }
+    });
+    Report(label, ours, theirs);
+}
+
+template <typename T>
+void BenchEraseFront(const char* label, size_t n) {
+    Vector<T> src_ours;
+    std::vector<T> src_theirs;
+    for (size_t i = 0; i < n; ++i) {
+        src_ours.PushBack(MakeElem<T>(static_cast<int>(i)));
+        src_theirs.push_back(MakeElem<T>(static_cast<int>(i)));
+    }
+    const double ours = BenchNsPerElem(n, [&] {
+        Vector<T> v(src_ours);
+        while (v.Size() > 0) {
+            v.Erase(v.begin());
+        }
+    });
+    const double theirs = BenchNsPerElem(n, [&] {
+        std::vector<T> v(src_theirs);
+        while (!v.empty()) {
+            v.erase(v.begin());
+        }
+    });
+    Report(label, ours, theirs);
+}
+
+template <typename T>
+void BenchReserve(const char* label, size_t n) {
+    const double ours = BenchNsPerElem(n, [n] {
+        Vector<T> v(n / 2);
+        v.Reserve(n);
+        DoNotOptimize(v);
+    });
+    const double theirs = BenchNsPerElem(n, [n] {
+        std::vector<T> v(n / 2);
+        v.reserve(n);
+        DoNotOptimize(v);
+    });
+    Report(label, ours, theirs);
+}
+
+template <typename T>
+void BenchCopyAssign(const char* label, size_t n) {
+    Vector<T> src_ours(n);
+    std::vector<T> src_theirs(n);
+    const double ours = BenchNsPerElem(n, [&] {
+        Vector<T> v;
+        v = src_ours;
+        DoNotOptimize(v);
+    });
+    const double theirs = BenchNsPerElem(n, [&] {
+        std::vector<T> v;
+        v = src_theirs;
+        DoNotOptimize(v);
+    });
+    Report(label, ours, theirs);
+}
+
+template <typename T>
+void BenchMoveAssign(const char* label, size_t n) {
+    const double ours = BenchNsPerElem(n, [n] {
+        Vector<T> src(n);
+        Vector<T> v;
+        v = std::move(src);
+        DoNotOptimize(v);
+    });
+    const double theirs = BenchNsPerElem(n, [n] {
+        std::vector<T> src(n);
+        std::vector<T> v;
+        v = std::move(src);
+        DoNotOptimize(v);
+    });
+    Report(label, ours, theirs);
+}
+
+}  // namespace
+
+int main() {
+    const size_t N = 1 << 20;
+    const size_t N_QUAD = 1 << 13;  // для квадратичных сценариев
+
+    std::printf("%-34s %10s %12s %8s\n", "benchmark (ns/elem)", "Vector", "std::vector", "ratio");
+
+    BenchPushBackGrowth<int>("PushBack growth <int>", N);
+    BenchPushBackGrowth<Movable>("PushBack growth <Movable>", N);
+    BenchPushBackGrowth<CopyOnly>("PushBack growth <CopyOnly>", N);
+
+    BenchEmplaceMiddle<int>("Emplace middle <int>", N_QUAD);
+    BenchEmplaceMiddle<Movable>("Emplace middle <Movable>", N_QUAD);
+
+    BenchEraseFront<int>("Erase front <int>", N_QUAD);
+    BenchEraseFront<Movable>("Erase front <Movable>", N_QUAD);
+
+    BenchReserve<int>("Reserve <int>", N);
+    BenchReserve<Movable>("Reserve <Movable>", N);
+
+    BenchCopyAssign<int>("Copy assign <int>", N);
+    BenchCopyAssign<Movable>("Copy assign <Movable>", N);
+
+    BenchMoveAssign<int>("Move assign <int>", N);
+    BenchMoveAssign<Movable>("Move assign <Movable>", N);
+}
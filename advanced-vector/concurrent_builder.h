@@ -0,0 +1,72 @@
+#pragma once
+#include "vector.h"
+
+// Параллельное наполнение вектора без общего мьютекса. Каждый поток-продюсер
+// пишет в собственный шард (обычный Vector, выровненный на кеш-линию против
+// false sharing), а Build склеивает шарды в итоговый Vector одним Reserve и
+// перемещением элементов. Блокировок нет вовсе: синхронизация сводится к
+// join потоков перед Build.
+template <typename T, typename Alloc = std::allocator<T>>
+class ConcurrentBuilder {
+public:
+    explicit ConcurrentBuilder(size_t num_shards, const Alloc& alloc = Alloc())
+        : alloc_(alloc)
+        , num_shards_(num_shards)
+        , shards_(new PaddedShard[num_shards])
+    {
+        assert(num_shards > 0);
+        for (size_t i = 0; i < num_shards_; ++i) {
+            shards_[i].elems = Vector<T, Alloc>(alloc_);
+        }
+    }
+
+    ConcurrentBuilder(const ConcurrentBuilder&) = delete;
+    ConcurrentBuilder& operator=(const ConcurrentBuilder&) = delete;
+
+    ~ConcurrentBuilder()
+    {
+        delete[] shards_;
+    }
+
+    size_t NumShards() const noexcept
+    {
+        return num_shards_;
+    }
+
+    // Шард принадлежит ровно одному потоку — внутри него никакой синхронизации нет
+    Vector<T, Alloc>& GetShard(size_t index) noexcept
+    {
+        assert(index < num_shards_);
+        return shards_[index].elems;
+    }
+
+    // Склеивает шарды в порядке их индексов. Вызывать только после завершения
+    // всех продюсеров. Шарды опустошаются, построитель можно наполнять заново
+    Vector<T, Alloc> Build()
+    {
+        size_t total = 0;
+        for (size_t i = 0; i < num_shards_; ++i) {
+            total += shards_[i].elems.Size();
+        }
+        Vector<T, Alloc> result(alloc_);
+        result.Reserve(total);
+        for (size_t i = 0; i < num_shards_; ++i) {
+            Vector<T, Alloc>& shard = shards_[i].elems;
+            // Для тривиально перемещаемых типов move-итераторы сводятся к memcpy
+            result.AppendRange(std::make_move_iterator(shard.begin()),
+                std::make_move_iterator(shard.end()));
+            shard = Vector<T, Alloc>(alloc_);
+        }
+        return result;
+    }
+
+private:
+    // Выравнивание защищает соседние шарды от борьбы за одну кеш-линию
+    struct alignas(64) PaddedShard {
+        Vector<T, Alloc> elems;
+    };
+
+    Alloc alloc_;
+    size_t num_shards_;
+    PaddedShard* shards_;
+};
@@ -0,0 +1,104 @@
+#pragma once
+#include <cassert>
+#include <cstddef>
+#include <utility>
+
+// Вектор для constant evaluation: таблицы, построенные им в constexpr-функции,
+// вычисляются компилятором и попадают в read-only данные — нулевая цена на
+// старте процесса. В C++17 constexpr-коду недоступны placement new и сырая
+// память, поэтому ёмкость фиксирована, элементы хранятся массивом и требуют
+// default-конструируемости, а PushBack работает присваиванием.
+// Основной Vector остаётся на realloc/memcpy-путях, которые в константных
+// выражениях невозможны до C++20
+template <typename T, size_t N>
+class ConstexprVector {
+    static_assert(N > 0, "Ёмкость должна быть больше нуля");
+
+public:
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    constexpr ConstexprVector() = default;
+
+    constexpr iterator begin() noexcept
+    {
+        return elems_;
+    }
+
+    constexpr iterator end() noexcept
+    {
+        return elems_ + size_;
+    }
+
+    constexpr const_iterator begin() const noexcept
+    {
+        return elems_;
+    }
+
+    constexpr const_iterator end() const noexcept
+    {
+        return elems_ + size_;
+    }
+
+    constexpr size_t Size() const noexcept
+    {
+        return size_;
+    }
+
+    static constexpr size_t Capacity() noexcept
+    {
+        return N;
+    }
+
+    constexpr const T& operator[](size_t index) const noexcept
+    {
+        assert(index < size_);
+        return elems_[index];
+    }
+
+    constexpr T& operator[](size_t index) noexcept
+    {
+        assert(index < size_);
+        return elems_[index];
+    }
+
+    constexpr void PushBack(const T& value)
+    {
+        assert(size_ < N);
+        elems_[size_] = value;
+        ++size_;
+    }
+
+    constexpr void PushBack(T&& value)
+    {
+        assert(size_ < N);
+        elems_[size_] = std::move(value);
+        ++size_;
+    }
+
+    template <typename... Args>
+    constexpr T& EmplaceBack(Args&&... args)
+    {
+        assert(size_ < N);
+        elems_[size_] = T(std::forward<Args>(args)...);
+        return elems_[size_++];
+    }
+
+    constexpr void PopBack() noexcept
+    {
+        assert(size_ > 0);
+        elems_[--size_] = T{};
+    }
+
+    constexpr void Clear() noexcept
+    {
+        for (size_t i = 0; i < size_; ++i) {
+            elems_[i] = T{};
+        }
+        size_ = 0;
+    }
+
+private:
+    T elems_[N] {};
+    size_t size_ = 0;
+};
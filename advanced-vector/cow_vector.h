@@ -0,0 +1,296 @@
+#pragma once
+#include "vector.h"
+
+#include <atomic>
+
+// Copy-on-write вектор для read-mostly нагрузок: Freeze() выдаёт дешёвый
+// неизменяемый снимок (инкремент счётчика ссылок вместо глубокой копии),
+// а писатель продолжает работать со своим CowVector — первая же мутация при
+// живых снимках прозрачно копирует буфер. Десятки читателей многогигабайтного
+// вектора перестают платить O(n) копий и двойную память на каждого.
+// Счётчик атомарный: снимки можно раздавать в другие потоки; сами объекты
+// CowVector и Snapshot, как и всё здесь, не для конкурентной записи
+
+template <typename T>
+class Snapshot;
+
+template <typename T>
+class CowVector {
+public:
+    using const_iterator = const T*;
+
+    CowVector() = default;
+
+    CowVector(const CowVector& other) noexcept
+        : shared_(other.shared_)
+    {
+        Shared::AddRef(shared_);
+    }
+
+    CowVector(CowVector&& other) noexcept
+        : shared_(std::exchange(other.shared_, nullptr))
+    {
+    }
+
+    CowVector& operator=(const CowVector& rhs) noexcept
+    {
+        if (this != &rhs) {
+            Shared::AddRef(rhs.shared_);
+            Shared::SubRef(shared_);
+            shared_ = rhs.shared_;
+        }
+        return *this;
+    }
+
+    CowVector& operator=(CowVector&& rhs) noexcept
+    {
+        if (this != &rhs) {
+            Shared::SubRef(shared_);
+            shared_ = std::exchange(rhs.shared_, nullptr);
+        }
+        return *this;
+    }
+
+    ~CowVector()
+    {
+        Shared::SubRef(shared_);
+    }
+
+    size_t Size() const noexcept
+    {
+        return shared_ != nullptr ? shared_->size : 0;
+    }
+
+    size_t Capacity() const noexcept
+    {
+        return shared_ != nullptr ? shared_->data.Capacity() : 0;
+    }
+
+    const T& operator[](size_t index) const noexcept
+    {
+        assert(shared_ != nullptr && index < shared_->size);
+        return shared_->data[index];
+    }
+
+    const_iterator begin() const noexcept
+    {
+        return shared_ != nullptr ? shared_->data.GetAddress() : nullptr;
+    }
+
+    const_iterator end() const noexcept
+    {
+        return begin() + Size();
+    }
+
+    // Неизменяемый снимок текущего содержимого за O(1)
+    Snapshot<T> Freeze() const noexcept
+    {
+        return Snapshot<T>(shared_);
+    }
+
+    // Запись по индексу — мутация: при живых снимках буфер сперва копируется
+    T& Mutable(size_t index)
+    {
+        assert(shared_ != nullptr && index < shared_->size);
+        Detach(Capacity());
+        return shared_->data[index];
+    }
+
+    void Reserve(size_t new_capacity)
+    {
+        if (new_capacity > Capacity()) {
+            Detach(new_capacity);
+        }
+    }
+
+    void PushBack(const T& value)
+    {
+        EmplaceBack(value);
+    }
+
+    void PushBack(T&& value)
+    {
+        EmplaceBack(std::move(value));
+    }
+
+    template <typename... Args>
+    T& EmplaceBack(Args&&... args)
+    {
+        const size_t size = Size();
+        if (shared_ != nullptr && !IsShared() && size < shared_->data.Capacity()) {
+            T* result = new (shared_->data + size) T(std::forward<Args>(args)...);
+            ++shared_->size;
+            return *result;
+        }
+        // Рост или отделение от снимков: новый элемент конструируется в свежий
+        // буфер до освобождения старого — args могут ссылаться на этот же
+        // вектор, как в реаллоцирующей ветке Vector::EmplaceBack
+        const size_t capacity = size == Capacity() ? std::max<size_t>(1, Capacity() * 2) : Capacity();
+        auto* fresh = new Shared(std::max(capacity, size + 1));
+        T* result = nullptr;
+        try {
+            result = new (fresh->data + size) T(std::forward<Args>(args)...);
+            if (size != 0) {
+                try {
+                    std::uninitialized_copy_n(shared_->data.GetAddress(), size, fresh->data.GetAddress());
+                }
+                catch (...) {
+                    std::destroy_at(result);
+                    throw;
+                }
+            }
+        }
+        catch (...) {
+            delete fresh;
+            throw;
+        }
+        fresh->size = size + 1;
+        Shared::SubRef(shared_);
+        shared_ = fresh;
+        return *result;
+    }
+
+    void PopBack()
+    {
+        assert(Size() > 0);
+        Detach(Capacity());
+        --shared_->size;
+        std::destroy_at(shared_->data.GetAddress() + shared_->size);
+    }
+
+private:
+    friend class Snapshot<T>;
+
+    struct Shared {
+        explicit Shared(size_t capacity)
+            : data(capacity)
+        {
+        }
+
+        static void AddRef(Shared* s) noexcept
+        {
+            if (s != nullptr) {
+                s->refs.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+
+        static void SubRef(Shared* s) noexcept
+        {
+            if (s != nullptr && s->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                detail::DestroyN(s->data.GetAddress(), s->size);
+                delete s;
+            }
+        }
+
+        std::atomic<size_t> refs{1};
+        RawMemory<T> data;
+        size_t size = 0;
+    };
+
+    bool IsShared() const noexcept
+    {
+        return shared_ != nullptr && shared_->refs.load(std::memory_order_acquire) > 1;
+    }
+
+    // Гарантирует единоличное владение буфером ёмкости не меньше min_capacity.
+    // Разделённый буфер копируется: прежняя версия остаётся снимкам
+    void Detach(size_t min_capacity)
+    {
+        if (shared_ != nullptr && !IsShared() && shared_->data.Capacity() >= min_capacity) {
+            return;
+        }
+        const size_t size = Size();
+        auto* fresh = new Shared(std::max(min_capacity, size));
+        if (size != 0) {
+            try {
+                std::uninitialized_copy_n(shared_->data.GetAddress(), size, fresh->data.GetAddress());
+            }
+            catch (...) {
+                delete fresh;
+                throw;
+            }
+            fresh->size = size;
+        }
+        Shared::SubRef(shared_);
+        shared_ = fresh;
+    }
+
+    Shared* shared_ = nullptr;
+};
+
+// Дешёвое неизменяемое представление версии CowVector на момент Freeze.
+// Живёт независимо от породившего вектора и держит буфер от освобождения
+template <typename T>
+class Snapshot {
+public:
+    using const_iterator = const T*;
+
+    Snapshot(const Snapshot& other) noexcept
+        : shared_(other.shared_)
+    {
+        CowVector<T>::Shared::AddRef(shared_);
+    }
+
+    Snapshot(Snapshot&& other) noexcept
+        : shared_(std::exchange(other.shared_, nullptr))
+    {
+    }
+
+    Snapshot& operator=(const Snapshot& rhs) noexcept
+    {
+        if (this != &rhs) {
+            CowVector<T>::Shared::AddRef(rhs.shared_);
+            CowVector<T>::Shared::SubRef(shared_);
+            shared_ = rhs.shared_;
+        }
+        return *this;
+    }
+
+    Snapshot& operator=(Snapshot&& rhs) noexcept
+    {
+        if (this != &rhs) {
+            CowVector<T>::Shared::SubRef(shared_);
+            shared_ = std::exchange(rhs.shared_, nullptr);
+        }
+        return *this;
+    }
+
+    ~Snapshot()
+    {
+        CowVector<T>::Shared::SubRef(shared_);
+    }
+
+    size_t Size() const noexcept
+    {
+        return shared_ != nullptr ? size_ : 0;
+    }
+
+    const T& operator[](size_t index) const noexcept
+    {
+        assert(index < Size());
+        return shared_->data[index];
+    }
+
+    const_iterator begin() const noexcept
+    {
+        return shared_ != nullptr ? shared_->data.GetAddress() : nullptr;
+    }
+
+    const_iterator end() const noexcept
+    {
+        return begin() + Size();
+    }
+
+private:
+    friend class CowVector<T>;
+
+    explicit Snapshot(typename CowVector<T>::Shared* shared) noexcept
+        : shared_(shared)
+        , size_(shared != nullptr ? shared->size : 0)
+    {
+        CowVector<T>::Shared::AddRef(shared_);
+    }
+
+    typename CowVector<T>::Shared* shared_ = nullptr;
+    size_t size_ = 0;
+};
@@ -0,0 +1,223 @@
+#pragma once
+#include "vector.h"
+
+// Вектор с ёмкостью, зафиксированной на этапе компиляции: хранилище лежит
+// прямо в объекте, выделений нет вовсе, а вместо ветки реаллокации в
+// EmplaceBack — только debug-assert. Интерфейс повторяет Vector, так что
+// прикладной код компилируется против любого из контейнеров; переполнение —
+// ошибка программы, как выход за границы operator[]
+template <typename T, size_t N>
+class FixedVector {
+    static_assert(N > 0, "Ёмкость должна быть больше нуля");
+
+public:
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    iterator begin() noexcept
+    {
+        return Data();
+    }
+
+    iterator end() noexcept
+    {
+        return Data() + size_;
+    }
+
+    const_iterator begin() const noexcept
+    {
+        return Data();
+    }
+
+    const_iterator end() const noexcept
+    {
+        return Data() + size_;
+    }
+
+    const_iterator cbegin() const noexcept
+    {
+        return begin();
+    }
+
+    const_iterator cend() const noexcept
+    {
+        return end();
+    }
+
+    FixedVector() = default;
+
+    explicit FixedVector(size_t size)
+        : size_(size)
+    {
+        assert(size <= N);
+        std::uninitialized_value_construct_n(Data(), size);
+    }
+
+    FixedVector(const FixedVector& other)
+        : size_(other.size_)
+    {
+        std::uninitialized_copy_n(other.Data(), other.size_, Data());
+    }
+
+    FixedVector(FixedVector&& other) noexcept(detail::kIsNothrowRelocatable<T>)
+        : size_(other.size_)
+    {
+        detail::RelocateN(other.Data(), other.size_, Data());
+        detail::DestroyRelocatedN(other.Data(), other.size_);
+        other.size_ = 0;
+    }
+
+    FixedVector& operator=(const FixedVector& rhs)
+    {
+        if (this != &rhs) {
+            std::copy(rhs.Data(), rhs.Data() + std::min(rhs.size_, size_), Data());
+            if (rhs.size_ < size_) {
+                std::destroy_n(Data() + rhs.size_, size_ - rhs.size_);
+            }
+            else {
+                std::uninitialized_copy_n(rhs.Data() + size_, rhs.size_ - size_, Data() + size_);
+            }
+            size_ = rhs.size_;
+        }
+        return *this;
+    }
+
+    FixedVector& operator=(FixedVector&& rhs) noexcept(detail::kIsNothrowRelocatable<T>)
+    {
+        if (this != &rhs) {
+            std::destroy_n(Data(), size_);
+            detail::RelocateN(rhs.Data(), rhs.size_, Data());
+            detail::DestroyRelocatedN(rhs.Data(), rhs.size_);
+            size_ = std::exchange(rhs.size_, 0);
+        }
+        return *this;
+    }
+
+    ~FixedVector()
+    {
+        std::destroy_n(Data(), size_);
+    }
+
+    size_t Size() const noexcept
+    {
+        return size_;
+    }
+
+    static constexpr size_t Capacity() noexcept
+    {
+        return N;
+    }
+
+    const T& operator[](size_t index) const noexcept
+    {
+        return const_cast<FixedVector&>(*this)[index];
+    }
+
+    T& operator[](size_t index) noexcept
+    {
+        assert(index < size_);
+        return Data()[index];
+    }
+
+    void Swap(FixedVector& other) noexcept(detail::kIsNothrowRelocatable<T>&& std::is_nothrow_swappable_v<T>)
+    {
+        FixedVector& shorter = size_ < other.size_ ? *this : other;
+        FixedVector& longer = size_ < other.size_ ? other : *this;
+        std::swap_ranges(shorter.Data(), shorter.Data() + shorter.size_, longer.Data());
+        detail::RelocateN(longer.Data() + shorter.size_, longer.size_ - shorter.size_,
+            shorter.Data() + shorter.size_);
+        detail::DestroyRelocatedN(longer.Data() + shorter.size_, longer.size_ - shorter.size_);
+        std::swap(size_, other.size_);
+    }
+
+    void Resize(size_t new_size)
+    {
+        assert(new_size <= N);
+        if (new_size < size_) {
+            std::destroy_n(Data() + new_size, size_ - new_size);
+        }
+        else {
+            std::uninitialized_value_construct_n(Data() + size_, new_size - size_);
+        }
+        size_ = new_size;
+    }
+
+    void PushBack(const T& value)
+    {
+        EmplaceBack(value);
+    }
+
+    void PushBack(T&& value)
+    {
+        EmplaceBack(std::move(value));
+    }
+
+    // Без проверки ёмкости в релизе: ни выделения, ни ветки — только конструктор
+    template <typename... Args>
+    T& EmplaceBack(Args&&... args)
+    {
+        assert(size_ < N);
+        T* result = new (Data() + size_) T(std::forward<Args>(args)...);
+        ++size_;
+        return *result;
+    }
+
+    void PopBack() noexcept
+    {
+        assert(size_ > 0);
+        --size_;
+        std::destroy_at(Data() + size_);
+    }
+
+    template <typename... Args>
+    iterator Emplace(const_iterator pos, Args&&... args)
+    {
+        assert(pos >= begin() && pos <= end());
+        assert(size_ < N);
+        const size_t shift = pos - begin();
+        if (shift == size_) {
+            EmplaceBack(std::forward<Args>(args)...);
+        }
+        else {
+            T value(std::forward<Args>(args)...);
+            new (Data() + size_) T(std::move(Data()[size_ - 1]));
+            std::move_backward(begin() + shift, end() - 1, end());
+            Data()[shift] = std::move(value);
+            ++size_;
+        }
+        return begin() + shift;
+    }
+
+    iterator Insert(const_iterator pos, const T& value)
+    {
+        return Emplace(pos, value);
+    }
+
+    iterator Insert(const_iterator pos, T&& value)
+    {
+        return Emplace(pos, std::move(value));
+    }
+
+    iterator Erase(const_iterator pos) noexcept(std::is_nothrow_move_assignable_v<T>)
+    {
+        assert(pos >= begin() && pos < end());
+        const size_t shift = pos - begin();
+        std::move(begin() + shift + 1, end(), begin() + shift);
+        PopBack();
+        return begin() + shift;
+    }
+
+private:
+    T* Data() noexcept
+    {
+        return reinterpret_cast<T*>(buf_);
+    }
+
+    const T* Data() const noexcept
+    {
+        return reinterpret_cast<const T*>(buf_);
+    }
+
+    alignas(T) unsigned char buf_[N * sizeof(T)];
+    size_t size_ = 0;
+};
@@ -1,8 +1,23 @@
+#include "allocators.h"
+#include "concurrent_builder.h"
+#include "constexpr_vector.h"
+#include "cow_vector.h"
+#include "fixed_vector.h"
+#include "mapped_vector.h"
+#include "segmented_vector.h"
+#include "small_vector.h"
+#include "sorted_vector.h"
+#include "soa_vector.h"
 #include "vector.h"
 
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
 #include <iostream>
 #include <stdexcept>
 #include <string>
+#include <vector>
 
 namespace {
 
@@ -98,8 +113,87 @@ struct Obj {
     static inline int num_destroyed = 0;
 };
 
+// Аллокатор, считающий выделения и освобождения, — для проверки allocator-aware пути
+template <typename T>
+struct CountingAllocator {
+    using value_type = T;
+
+    CountingAllocator() = default;
+    explicit CountingAllocator(int id) noexcept
+        : id(id) {
+    }
+    template <typename U>
+    CountingAllocator(const CountingAllocator<U>& other) noexcept
+        : id(other.id) {
+    }
+
+    T* allocate(size_t n) {
+        ++num_allocations;
+        return static_cast<T*>(operator new(n * sizeof(T)));
+    }
+
+    void deallocate(T* p, size_t /*n*/) noexcept {
+        ++num_deallocations;
+        operator delete(p);
+    }
+
+    int id = 0;
+
+    static inline int num_allocations = 0;
+    static inline int num_deallocations = 0;
+};
+
+template <typename T, typename U>
+bool operator==(const CountingAllocator<T>& lhs, const CountingAllocator<U>& rhs) noexcept {
+    return lhs.id == rhs.id;
+}
+template <typename T, typename U>
+bool operator!=(const CountingAllocator<T>& lhs, const CountingAllocator<U>& rhs) noexcept {
+    return !(lhs == rhs);
+}
+
+// Тип, который семантически переносим memcpy, хотя move/деструктор нетривиальны:
+// владеет числом в куче, как маленькая строка
+struct Reloc {
+    explicit Reloc(int value)
+        : p(new int(value)) {
+        ++num_alive;
+    }
+    Reloc(const Reloc& other)
+        : p(new int(*other.p)) {
+        ++num_alive;
+        ++num_copies;
+    }
+    Reloc(Reloc&& other) noexcept
+        : p(std::exchange(other.p, nullptr)) {
+        ++num_alive;
+        ++num_moves;
+    }
+    Reloc& operator=(const Reloc&) = delete;
+    Reloc& operator=(Reloc&& other) noexcept {
+        delete p;
+        p = std::exchange(other.p, nullptr);
+        ++num_moves;
+        return *this;
+    }
+    ~Reloc() {
+        delete p;
+        --num_alive;
+    }
+
+    int* p;
+
+    static inline int num_moves = 0;
+    static inline int num_copies = 0;
+    static inline int num_alive = 0;
+};
+
 }  // namespace
 
+// Объявляем Reloc memcpy-переносимым — реаллокации обязаны идти без move/dtor
+template <>
+struct IsTriviallyRelocatable<Reloc> : std::true_type {};
+
 void Test1() {
     Obj::ResetCounters();
     const size_t SIZE = 100500;
@@ -380,6 +474,1125 @@ void Test5() {
     }
 }
 
+void Test6() {
+    using Allocator = CountingAllocator<int>;
+    const size_t SIZE = 10;
+    {
+        Allocator::num_allocations = 0;
+        Allocator::num_deallocations = 0;
+        Vector<int, Allocator> v(SIZE, Allocator{42});
+        assert(v.Size() == SIZE);
+        assert(Allocator::num_allocations == 1);
+        assert(v.GetAllocator().id == 42);
+
+        // Реаллокация должна идти через тот же аллокатор
+        v.Reserve(SIZE * 2);
+        assert(Allocator::num_allocations == 2);
+        assert(Allocator::num_deallocations == 1);
+
+        // Копия наследует аллокатор через select_on_container_copy_construction
+        Vector<int, Allocator> v_copy(v);
+        assert(v_copy.GetAllocator().id == 42);
+
+        // Перемещение передаёт буфер без нового выделения
+        const int old_allocations = Allocator::num_allocations;
+        Vector<int, Allocator> v_moved(std::move(v_copy));
+        assert(v_moved.Size() == SIZE);
+        assert(Allocator::num_allocations == old_allocations);
+    }
+    assert(Allocator::num_allocations == Allocator::num_deallocations);
+}
+
+void Test7() {
+    // Для тривиально копируемых типов реаллокации и сдвиги идут через memcpy/memmove —
+    // проверяем, что значения и порядок при этом не ломаются
+    const size_t SIZE = 1000;
+    Vector<int> v;
+    for (size_t i = 0; i < SIZE; ++i) {
+        v.PushBack(static_cast<int>(i));
+    }
+    v.Insert(v.begin(), -1);
+    v.Insert(v.begin() + 501, -2);
+    assert(v.Size() == SIZE + 2);
+    assert(v[0] == -1);
+    assert(v[501] == -2);
+    assert(v[502] == 500);
+    assert(v[SIZE + 1] == static_cast<int>(SIZE) - 1);
+    v.Erase(v.begin() + 501);
+    v.Erase(v.begin());
+    assert(v.Size() == SIZE);
+    for (size_t i = 0; i < SIZE; ++i) {
+        assert(v[i] == static_cast<int>(i));
+    }
+}
+
+void Test8() {
+    using Allocator = CountingAllocator<int>;
+    {
+        Allocator::num_allocations = 0;
+        Allocator::num_deallocations = 0;
+        SmallVector<int, 8, Allocator> v;
+        for (int i = 0; i < 8; ++i) {
+            v.PushBack(i);
+        }
+        // Пока элементы помещаются во встроенный буфер, кучи быть не должно
+        assert(v.IsInline());
+        assert(v.Capacity() == 8);
+        assert(Allocator::num_allocations == 0);
+
+        v.PushBack(8);
+        assert(!v.IsInline());
+        assert(Allocator::num_allocations == 1);
+        for (int i = 0; i < 9; ++i) {
+            assert(v[i] == i);
+        }
+    }
+    assert(Allocator::num_allocations == Allocator::num_deallocations);
+    {
+        // Обмен встроенного и кучевого состояний
+        SmallVector<Obj, 4> small;
+        small.EmplaceBack(1);
+        SmallVector<Obj, 4> big;
+        for (int i = 0; i < 10; ++i) {
+            big.EmplaceBack(100 + i);
+        }
+        small.Swap(big);
+        assert(!small.IsInline());
+        assert(small.Size() == 10);
+        assert(small[9].id == 109);
+        assert(big.IsInline());
+        assert(big.Size() == 1);
+        assert(big[0].id == 1);
+    }
+    {
+        // Перемещение из встроенного состояния не оставляет висячих элементов
+        Obj::ResetCounters();
+        SmallVector<Obj, 4> v;
+        v.EmplaceBack(7);
+        SmallVector<Obj, 4> moved(std::move(v));
+        assert(moved.Size() == 1);
+        assert(moved[0].id == 7);
+        assert(v.Size() == 0);
+    }
+    assert(Obj::GetAliveObjectCount() == 0);
+}
+
+void Test9() {
+    const size_t SIZE = 10'000;
+    {
+        // Пакетное добавление делает не больше одной реаллокации
+        std::vector<int> src(SIZE);
+        for (size_t i = 0; i < SIZE; ++i) {
+            src[i] = static_cast<int>(i);
+        }
+        Vector<int> v;
+        v.PushBack(-1);
+        const size_t old_capacity = v.Capacity();
+        v.AppendRange(src.begin(), src.end());
+        assert(v.Size() == SIZE + 1);
+        assert(v.Capacity() >= SIZE + 1);
+        assert(v.Capacity() > old_capacity);
+        assert(v[0] == -1);
+        assert(v[SIZE] == static_cast<int>(SIZE) - 1);
+    }
+    {
+        Obj::ResetCounters();
+        Vector<Obj> v(4);
+        std::vector<Obj> src;
+        src.emplace_back(1);
+        src.emplace_back(2);
+        // Вставка диапазона в середину с реаллокацией
+        v.Insert(v.begin() + 2, src.begin(), src.end());
+        assert(v.Size() == 6);
+        assert(v[2].id == 1);
+        assert(v[3].id == 2);
+        // ... и без реаллокации
+        v.Reserve(16);
+        v.Insert(v.begin() + 1, src.begin(), src.end());
+        assert(v.Size() == 8);
+        assert(v[1].id == 1);
+        assert(v[2].id == 2);
+        assert(v[4].id == 1);
+    }
+    assert(Obj::GetAliveObjectCount() == 0);
+}
+
+void Test10() {
+    const size_t SIZE = 1000;
+    {
+        // Конструктор с kDefaultInit не обязан зануляться — проверяем только
+        // размер/ёмкость и что буфер пригоден для записи
+        Vector<uint64_t> v(SIZE, kDefaultInit);
+        assert(v.Size() == SIZE);
+        assert(v.Capacity() == SIZE);
+        for (size_t i = 0; i < SIZE; ++i) {
+            v[i] = i;
+        }
+        assert(v[SIZE - 1] == SIZE - 1);
+
+        v.ResizeUninitialized(SIZE * 2);
+        assert(v.Size() == SIZE * 2);
+        assert(v[SIZE - 1] == SIZE - 1);
+    }
+    {
+        // Для нетривиальных типов конструирование по умолчанию всё равно происходит
+        Obj::ResetCounters();
+        Vector<Obj> v(10, kDefaultInit);
+        assert(Obj::num_default_constructed == 10);
+        v.ResizeUninitialized(5);
+        assert(Obj::num_destroyed == 5);
+    }
+    assert(Obj::GetAliveObjectCount() == 0);
+}
+
+void Test11() {
+    const size_t SIZE = 100;
+    {
+        Obj::ResetCounters();
+        Vector<Obj> v(SIZE);
+        v.Reserve(SIZE * 4);
+        assert(v.Capacity() == SIZE * 4);
+        v.ShrinkToFit();
+        assert(v.Capacity() == SIZE);
+        assert(v.Size() == SIZE);
+        assert(Obj::GetAliveObjectCount() == SIZE);
+
+        v.ReleaseCapacity();
+        assert(v.Size() == 0);
+        assert(v.Capacity() == 0);
+        assert(Obj::GetAliveObjectCount() == 0);
+
+        // Пустой вектор с ёмкостью тоже должен уметь её вернуть
+        v.Reserve(SIZE);
+        v.ShrinkToFit();
+        assert(v.Capacity() == 0);
+    }
+    assert(Obj::GetAliveObjectCount() == 0);
+}
+
+void Test12() {
+    {
+        // Рост в полтора раза: ёмкость не должна удваиваться
+        Vector<int, std::allocator<int>, GrowthOneAndHalf> v;
+        size_t prev_capacity = 0;
+        for (int i = 0; i < 1000; ++i) {
+            v.PushBack(i);
+            if (prev_capacity > 4) {
+                assert(v.Capacity() <= prev_capacity + prev_capacity / 2);
+            }
+            prev_capacity = v.Capacity();
+        }
+        assert(v.Capacity() < 2000);
+        for (int i = 0; i < 1000; ++i) {
+            assert(v[i] == i);
+        }
+    }
+    {
+        // Постраничное квантование: ёмкость в байтах кратна размеру страницы
+        Vector<char, std::allocator<char>, GrowthPageQuantized> v;
+        for (int i = 0; i < 100; ++i) {
+            v.PushBack('a');
+        }
+        assert(v.Capacity() % GrowthPageQuantized::kPageBytes == 0);
+        v.Resize(10'000);
+        assert(v.Capacity() % GrowthPageQuantized::kPageBytes == 0);
+    }
+}
+
+void Test13() {
+    {
+        Reloc::num_moves = 0;
+        Reloc::num_copies = 0;
+        Vector<Reloc> v;
+        for (int i = 0; i < 1000; ++i) {
+            v.EmplaceBack(i);
+        }
+        // Все реаллокации прошли побайтово: ни одного move и ни одной копии
+        assert(Reloc::num_moves == 0);
+        assert(Reloc::num_copies == 0);
+        assert(*v[999].p == 999);
+
+        v.Erase(v.begin() + 500);
+        assert(Reloc::num_moves == 0);
+        assert(v.Size() == 999);
+        assert(*v[500].p == 501);
+
+        // Erase(end()) — допустимый no-op, как и раньше у нетривиальных типов
+        v.Erase(v.end());
+        assert(v.Size() == 999);
+
+        v.ShrinkToFit();
+        assert(Reloc::num_moves == 0);
+        assert(*v[0].p == 0);
+        assert(*v[998].p == 999);
+    }
+    assert(Reloc::num_alive == 0);
+}
+
+void Test14() {
+    {
+        Obj::ResetCounters();
+        Vector<Obj> v;
+        for (int i = 0; i < 10; ++i) {
+            v.EmplaceBack(i);
+        }
+        // Диапазонное удаление: один сдвиг хвоста
+        v.Erase(v.begin() + 2, v.begin() + 5);
+        assert(v.Size() == 7);
+        assert(v[1].id == 1);
+        assert(v[2].id == 5);
+        assert(v[6].id == 9);
+
+        // Фильтрация одним проходом
+        const size_t removed = v.EraseIf([](const Obj& obj) { return obj.id % 2 == 0; });
+        assert(removed == 3);
+        assert(v.Size() == 4);
+        assert(v[0].id == 1 && v[1].id == 5 && v[2].id == 7 && v[3].id == 9);
+
+        // O(1)-удаление без сохранения порядка
+        v.SwapRemove(v.begin());
+        assert(v.Size() == 3);
+        assert(v[0].id == 9);
+    }
+    assert(Obj::GetAliveObjectCount() == 0);
+    {
+        // Диапазонное удаление по memcpy-переносимому типу
+        Reloc::num_moves = 0;
+        Vector<Reloc> v;
+        for (int i = 0; i < 10; ++i) {
+            v.EmplaceBack(i);
+        }
+        v.Erase(v.begin() + 1, v.begin() + 9);
+        assert(Reloc::num_moves == 0);
+        assert(v.Size() == 2);
+        assert(*v[0].p == 0 && *v[1].p == 9);
+    }
+    assert(Reloc::num_alive == 0);
+}
+
+void Test15() {
+    {
+        // Буфер выровнен под кеш-линию
+        Vector<double, AlignedAllocator<double, 64>> v(100);
+        assert(reinterpret_cast<uintptr_t>(&v[0]) % 64 == 0);
+        v.PushBack(42.0);
+        assert(reinterpret_cast<uintptr_t>(&v[0]) % 64 == 0);
+        assert(v[100] == 42.0);
+    }
+    {
+        // Большие блоки через mmap, мелкие — через operator new; содержимое цело в обоих случаях
+        Vector<uint64_t, HugePageAllocator<uint64_t>> v;
+        v.Resize(100);
+        v[0] = 1;
+        v.Resize(1'000'000);  // ~8 МБ — точно за порогом больших страниц
+        assert(v[0] == 1);
+        v[999'999] = 2;
+        assert(v[999'999] == 2);
+    }
+}
+
+void Test16() {
+    {
+        // Release отдаёт буфер без копий, Adopt оборачивает его обратно
+        Vector<int> v;
+        for (int i = 0; i < 100; ++i) {
+            v.PushBack(i);
+        }
+        size_t size = 0;
+        size_t capacity = 0;
+        int* buf = v.Release(size, capacity);
+        assert(v.Size() == 0);
+        assert(v.Capacity() == 0);
+        assert(size == 100);
+        assert(capacity >= 100);
+        assert(buf[99] == 99);
+
+        Vector<int> adopted = Vector<int>::Adopt(buf, size, capacity);
+        assert(adopted.Size() == 100);
+        assert(adopted[0] == 0 && adopted[99] == 99);
+        adopted.PushBack(100);
+        assert(adopted[100] == 100);
+    }
+    {
+        // Для int буферы совместимы с malloc — имитация DMA-буфера
+        int* raw = static_cast<int*>(std::malloc(16 * sizeof(int)));
+        for (int i = 0; i < 16; ++i) {
+            raw[i] = i * i;
+        }
+        auto v = Vector<int>::Adopt(raw, 16, 16);
+        assert(v[15] == 225);
+    }
+}
+
+void Test17() {
+#if defined(__linux__)
+    const char* path = "/tmp/advanced_vector_test17.bin";
+    {
+        Vector<int> v;
+        for (int i = 0; i < 10'000; ++i) {
+            v.PushBack(i * 3);
+        }
+        SaveToFile(v, path);
+    }
+    {
+        MappedVector<int> mapped(path);
+        assert(mapped.Size() == 10'000);
+        assert(mapped[0] == 0);
+        assert(mapped[9'999] == 9'999 * 3);
+        int64_t sum = 0;
+        for (int x : mapped) {
+            sum += x;
+        }
+        assert(sum == int64_t{9'999} * 10'000 / 2 * 3);
+
+        // Материализация обратно в изменяемый вектор
+        Vector<int> copy = mapped.ToVector();
+        assert(copy.Size() == mapped.Size());
+        assert(copy[42] == mapped[42]);
+    }
+    {
+        // Повреждённый файл отклоняется при открытии
+        bool thrown = false;
+        try {
+            MappedVector<double> wrong_type(path);
+        } catch (const std::runtime_error&) {
+            thrown = true;
+        }
+        assert(thrown);
+    }
+    {
+        // count, переполняющий count * sizeof(T), тоже отклоняется
+        std::FILE* f = std::fopen(path, "r+b");
+        assert(f != nullptr);
+        const uint64_t huge_count = (uint64_t{1} << 62) + 1;
+        std::fseek(f, offsetof(mapped_detail::FileHeader, count), SEEK_SET);
+        std::fwrite(&huge_count, sizeof(huge_count), 1, f);
+        std::fclose(f);
+        bool thrown = false;
+        try {
+            MappedVector<int> corrupt(path);
+        } catch (const std::runtime_error&) {
+            thrown = true;
+        }
+        assert(thrown);
+    }
+    std::remove(path);
+#endif
+}
+
+void Test18() {
+    {
+        // Восемь продюсеров наполняют свои шарды без какой-либо синхронизации
+        constexpr size_t num_threads = 8;
+        constexpr int per_thread = 10'000;
+        ConcurrentBuilder<int> builder(num_threads);
+        std::thread workers[num_threads];
+        for (size_t t = 0; t < num_threads; ++t) {
+            workers[t] = std::thread([&builder, t] {
+                auto& shard = builder.GetShard(t);
+                for (int i = 0; i < per_thread; ++i) {
+                    shard.PushBack(static_cast<int>(t) * per_thread + i);
+                }
+            });
+        }
+        for (auto& w : workers) {
+            w.join();
+        }
+        Vector<int> result = builder.Build();
+        assert(result.Size() == num_threads * per_thread);
+        // Шарды склеиваются по порядку индексов, значит результат монотонный
+        for (size_t i = 0; i < result.Size(); ++i) {
+            assert(result[i] == static_cast<int>(i));
+        }
+        // После Build построитель пуст и пригоден для повторного цикла
+        builder.GetShard(0).PushBack(-1);
+        Vector<int> second = builder.Build();
+        assert(second.Size() == 1 && second[0] == -1);
+    }
+    {
+        // Нетривиальный тип: элементы переезжают перемещением, без лишних копий
+        ConcurrentBuilder<std::string> builder(2);
+        builder.GetShard(0).PushBack(std::string(100, 'a'));
+        builder.GetShard(1).PushBack(std::string(100, 'b'));
+        Vector<std::string> result = builder.Build();
+        assert(result.Size() == 2);
+        assert(result[0][0] == 'a' && result[1][0] == 'b');
+    }
+}
+
+namespace {
+
+// Перемещение не помечено noexcept — строгая гарантия вынуждена копировать
+struct ThrowingMove {
+    inline static size_t num_moves = 0;
+    inline static size_t num_copies = 0;
+
+    ThrowingMove() = default;
+    ThrowingMove(const ThrowingMove&) {
+        ++num_copies;
+    }
+    ThrowingMove(ThrowingMove&&) noexcept(false) {
+        ++num_moves;
+    }
+};
+
+}  // namespace
+
+void Test19() {
+    {
+        // Strong: рост буфера идёт через копирование
+        ThrowingMove::num_moves = 0;
+        ThrowingMove::num_copies = 0;
+        Vector<ThrowingMove> v;
+        for (int i = 0; i < 100; ++i) {
+            v.PushBack(ThrowingMove{});
+        }
+        assert(ThrowingMove::num_copies > 0);
+    }
+    {
+        // Fast: try/catch вырезаны, всегда перемещающий путь
+        ThrowingMove::num_moves = 0;
+        ThrowingMove::num_copies = 0;
+        FastVector<ThrowingMove> v;
+        for (int i = 0; i < 100; ++i) {
+            v.PushBack(ThrowingMove{});
+        }
+        assert(ThrowingMove::num_copies == 0);
+        assert(ThrowingMove::num_moves > 0);
+    }
+    {
+        // Остальной интерфейс при Fast-политике работает как обычно
+        FastVector<std::string> v;
+        v.PushBack("a");
+        v.PushBack("c");
+        v.Insert(v.begin() + 1, std::string("b"));
+        assert(v.Size() == 3 && v[1] == "b");
+        v.Erase(v.begin());
+        assert(v[0] == "b");
+    }
+}
+
+void Test20() {
+#if defined(ADVANCED_VECTOR_STATS)
+    // Размер подобран уникальным, чтобы найти именно эту инстанциацию в реестре
+    struct StatsProbe {
+        int payload[13] = {};
+    };
+    {
+        Vector<StatsProbe> v;
+        for (int i = 0; i < 1'000; ++i) {
+            v.PushBack(StatsProbe{});
+        }
+    }
+    bool found = false;
+    vector_stats::ForEach([&found](const vector_stats::Counters& c) {
+        if (c.elem_size != sizeof(StatsProbe)) {
+            return;
+        }
+        found = true;
+        // Рост без Reserve: серия реаллокаций и переносов, пик не меньше размера
+        assert(c.allocations.load() > 1);
+        assert(c.elements_relocated.load() > 0);
+        assert(c.peak_capacity.load() >= 1'000);
+        assert(c.bytes_requested.load() >= 1'000 * sizeof(StatsProbe));
+    });
+    assert(found);
+#endif
+}
+
+namespace {
+
+// Таблица квадратов, построенная целиком на этапе компиляции
+constexpr ConstexprVector<int, 32> MakeSquares(int count) {
+    ConstexprVector<int, 32> result;
+    for (int i = 0; i < count; ++i) {
+        result.PushBack(i * i);
+    }
+    return result;
+}
+
+constexpr auto kSquares = MakeSquares(10);
+static_assert(kSquares.Size() == 10);
+static_assert(kSquares[0] == 0);
+static_assert(kSquares[9] == 81);
+
+}  // namespace
+
+void Test21() {
+    // Компайл-таймовая таблица ведёт себя как обычный контейнер и в рантайме
+    int sum = 0;
+    for (int x : kSquares) {
+        sum += x;
+    }
+    assert(sum == 285);
+
+    ConstexprVector<int, 8> v;
+    v.EmplaceBack(1);
+    v.PushBack(2);
+    assert(v.Size() == 2 && v[1] == 2);
+    v.PopBack();
+    assert(v.Size() == 1);
+    v.Clear();
+    assert(v.Size() == 0);
+}
+
+void Test22() {
+    {
+        // Fill: memset-путь для нулевого образа и обычный для остальных значений
+        Vector<int> v;
+        for (int i = 0; i < 1'000; ++i) {
+            v.PushBack(i);
+        }
+        v.Fill(0);
+        assert(v[0] == 0 && v[999] == 0);
+        v.Fill(7);
+        assert(v[0] == 7 && v[999] == 7);
+        assert(v.Size() == 1'000);
+    }
+    {
+        // Assign(n, value): сжатие, расширение в ёмкость и с пересозданием буфера
+        Vector<int> v(100);
+        v.Assign(10, 42);
+        assert(v.Size() == 10 && v.Capacity() >= 100 && v[9] == 42);
+        v.Assign(50, 1);
+        assert(v.Size() == 50 && v[49] == 1);
+        const size_t old_capacity = v.Capacity();
+        v.Assign(10 * old_capacity, 2);
+        assert(v.Size() == 10 * old_capacity && v[0] == 2);
+    }
+    {
+        // Assign диапазоном и корректность на нетривиальном типе
+        const std::string src[] = {"a", "b", "c"};
+        Vector<std::string> v;
+        v.PushBack("x");
+        v.Assign(std::begin(src), std::end(src));
+        assert(v.Size() == 3 && v[2] == "c");
+        v.Assign(size_t{2}, std::string("q"));
+        assert(v.Size() == 2 && v[0] == "q" && v[1] == "q");
+    }
+    {
+        // Деструкторы лишних элементов вызываются, новых — конструкторы
+        const int instances_before = Obj::GetAliveObjectCount();
+        Vector<Obj> v(8);
+        v.Assign(3, Obj(1));
+        assert(Obj::GetAliveObjectCount() == instances_before + 3 + 0);
+        v.Assign(6, Obj(2));
+        assert(Obj::GetAliveObjectCount() == instances_before + 6);
+    }
+}
+
+void Test23() {
+    {
+        // Колонки непрерывны, скан одного поля не трогает остальные
+        SoaVector<int64_t, double, int32_t> trades;
+        for (int i = 0; i < 1'000; ++i) {
+            trades.PushBack(int64_t{i}, i * 0.5, int32_t(i % 7));
+        }
+        assert(trades.Size() == 1'000);
+        const int64_t* ids = trades.Column<0>();
+        int64_t sum = 0;
+        for (size_t i = 0; i < trades.Size(); ++i) {
+            sum += ids[i];
+        }
+        assert(sum == 999 * 1'000 / 2);
+        assert(trades.Get<1>(10) == 5.0);
+        assert(trades.Get<2>(8) == 1);
+
+        trades.PopBack();
+        assert(trades.Size() == 999);
+
+        // Reserve сохраняет данные во всех столбцах
+        trades.Reserve(5'000);
+        assert(trades.Capacity() >= 5'000);
+        assert(trades.Get<0>(998) == 998 && trades.Get<1>(998) == 499.0);
+    }
+    {
+        // Нетривиальные поля: копирование и перемещение столбцов
+        SoaVector<std::string, int> named;
+        named.PushBack(std::string("alpha"), 1);
+        named.PushBack(std::string("beta"), 2);
+        SoaVector<std::string, int> copy(named);
+        assert(copy.Get<0>(1) == "beta" && copy.Get<1>(1) == 2);
+        SoaVector<std::string, int> moved(std::move(named));
+        assert(moved.Size() == 2 && moved.Get<0>(0) == "alpha");
+        copy = moved;
+        assert(copy.Get<0>(0) == "alpha");
+    }
+    {
+        // PushBack собственного элемента безопасен и при росте столбцов
+        SoaVector<std::string, int> rows;
+        rows.PushBack(std::string("очень длинная строка без SSO: самоссылка"), 7);
+        while (rows.Size() < rows.Capacity()) {
+            rows.PushBack(rows.Get<0>(0), rows.Get<1>(0));
+        }
+        rows.PushBack(rows.Get<0>(0), rows.Get<1>(0));
+        assert(rows.Get<0>(rows.Size() - 1) == rows.Get<0>(0));
+        assert(rows.Get<1>(rows.Size() - 1) == 7);
+    }
+}
+
+void Test24() {
+    {
+        // Рост добавляет блоки, адреса существующих элементов не меняются
+        SegmentedVector<int, 64> v;
+        v.PushBack(1);
+        const int* stable = &v[0];
+        for (int i = 1; i < 10'000; ++i) {
+            v.PushBack(i + 1);
+        }
+        assert(&v[0] == stable);
+        assert(v.Size() == 10'000);
+        assert(v[0] == 1 && v[9'999] == 10'000);
+        assert(v.Capacity() % 64 == 0);
+
+        int64_t sum = 0;
+        for (int x : v) {
+            sum += x;
+        }
+        assert(sum == int64_t{10'000} * 10'001 / 2);
+
+        for (int i = 0; i < 9'000; ++i) {
+            v.PopBack();
+        }
+        v.ShrinkToFit();
+        assert(v.Capacity() >= v.Size() && v.Capacity() < v.Size() + 2 * 64);
+    }
+    {
+        // Нетривиальный тип: деструкторы вызываются по всем блокам
+        Obj::ResetCounters();
+        {
+            SegmentedVector<Obj, 16> v;
+            for (int i = 0; i < 100; ++i) {
+                v.EmplaceBack(i);
+            }
+            assert(Obj::GetAliveObjectCount() == 100);
+            v.PopBack();
+            assert(Obj::GetAliveObjectCount() == 99);
+        }
+        assert(Obj::GetAliveObjectCount() == 0);
+    }
+}
+
+void Test25() {
+    {
+        // Генератор: одна проверка ёмкости, значения конструируются в слотах
+        Vector<int> v;
+        v.PushBack(-1);
+        v.EmplaceBackN(1'000, [](size_t i) {
+            return static_cast<int>(i * 2);
+        });
+        assert(v.Size() == 1'001);
+        assert(v[0] == -1 && v[1] == 0 && v[1'000] == 1'998);
+    }
+    {
+        // Фабрика конструирует по месту через placement new
+        Vector<std::string> v;
+        v.AppendFromFactory(3, [](std::string* slot, size_t i) {
+            new (slot) std::string(i + 1, 'x');
+        });
+        assert(v.Size() == 3);
+        assert(v[2] == "xxx");
+    }
+    {
+        // Исключение в генераторе: частично построенный хвост разрушается
+        Obj::ResetCounters();
+        Vector<Obj> v;
+        v.EmplaceBackN(5, [](size_t i) {
+            return Obj(static_cast<int>(i));
+        });
+        try {
+            v.EmplaceBackN(10, [](size_t i) -> Obj {
+                if (i == 4) {
+                    throw std::runtime_error("Oops");
+                }
+                return Obj(static_cast<int>(i));
+            });
+            assert(false && "Exception is expected");
+        } catch (const std::runtime_error&) {
+        }
+        assert(v.Size() == 5);
+        assert(Obj::GetAliveObjectCount() == 5);
+    }
+}
+
+void Test26() {
+    {
+        // Bind: крупный буфер через mmap+mbind, данные целы после роста
+        NumaAllocator<double> bind_node0(NumaPolicy::Bind, 0);
+        Vector<double, NumaAllocator<double>> v(bind_node0);
+        const size_t big = NumaAllocator<double>::kMmapThresholdBytes / sizeof(double) * 2;
+        v.Resize(big);
+        v[0] = 1.5;
+        v[big - 1] = 2.5;
+        v.Reserve(big * 2);
+        assert(v[0] == 1.5 && v[big - 1] == 2.5);
+        assert(v.GetAllocator() == bind_node0);
+    }
+    {
+        // Interleave и FirstTouch — разные аллокаторы, буферы между ними не передаются
+        NumaAllocator<int> interleave(NumaPolicy::Interleave);
+        NumaAllocator<int> first_touch(NumaPolicy::FirstTouch);
+        assert(interleave != first_touch);
+        Vector<int, NumaAllocator<int>> v(interleave);
+        for (int i = 0; i < 100'000; ++i) {
+            v.PushBack(i);
+        }
+        assert(v[99'999] == 99'999);
+    }
+}
+
+void Test27() {
+    {
+        // Снимок дешёвый и стабильный: мутации писателя его не трогают
+        CowVector<int> v;
+        for (int i = 0; i < 1'000; ++i) {
+            v.PushBack(i);
+        }
+        const int* buf_before = v.begin();
+        Snapshot<int> snap = v.Freeze();
+        assert(snap.Size() == 1'000);
+        assert(snap.begin() == buf_before);
+
+        v.PushBack(1'000);
+        // Копирование произошло у писателя, снимок остался на старом буфере
+        assert(v.begin() != buf_before);
+        assert(snap.begin() == buf_before);
+        assert(snap.Size() == 1'000 && v.Size() == 1'001);
+
+        v.Mutable(0) = -1;
+        assert(v[0] == -1 && snap[0] == 0);
+    }
+    {
+        // Без живых снимков мутации идут на месте, буфер не копируется
+        CowVector<int> v;
+        v.PushBack(1);
+        v.Reserve(100);
+        const int* buf = v.begin();
+        v.PushBack(2);
+        v.Mutable(0) = 5;
+        assert(v.begin() == buf);
+        assert(v[0] == 5 && v[1] == 2);
+    }
+    {
+        // Снимок переживает породивший его вектор; ресурсы освобождаются по счётчику
+        Obj::ResetCounters();
+        Snapshot<Obj>* survivor = nullptr;
+        {
+            CowVector<Obj> v;
+            for (int i = 0; i < 10; ++i) {
+                v.EmplaceBack(i);
+            }
+            survivor = new Snapshot<Obj>(v.Freeze());
+        }
+        assert(Obj::GetAliveObjectCount() == 10);
+        assert((*survivor)[9].id == 9);
+        delete survivor;
+        assert(Obj::GetAliveObjectCount() == 0);
+    }
+    {
+        // PushBack собственного элемента безопасен и при копирующем отделении
+        CowVector<std::string> v;
+        v.PushBack(std::string("очень длинная строка без SSO: самоссылка"));
+        while (v.Size() < v.Capacity()) {
+            v.PushBack(v[0]);
+        }
+        v.PushBack(v[0]);
+        assert(v[v.Size() - 1] == v[0]);
+
+        // То же при живом снимке: отделение копирует, самоссылка остаётся валидной
+        Snapshot<std::string> snap = v.Freeze();
+        v.PushBack(v[0]);
+        assert(v[v.Size() - 1] == snap[0]);
+    }
+}
+
+void Test28() {
+    // Имитация цикла recv: пишем прямо в свободный хвост и коммитим записанное
+    Vector<uint8_t> v;
+    v.Reserve(4'096);
+    const char chunk[] = "0123456789";
+    size_t total = 0;
+    while (total < 1'000) {
+        auto [tail, spare] = v.GetSpareCapacity();
+        assert(spare >= 10);
+        std::memcpy(tail, chunk, 10);
+        v.CommitSize(10);
+        total += 10;
+    }
+    assert(v.Size() == 1'000);
+    assert(v.Capacity() == 4'096);
+    assert(v[0] == '0' && v[9] == '9' && v[999] == '9');
+
+    // После дозаполнения ёмкости обычный рост продолжает работать
+    auto [tail, spare] = v.GetSpareCapacity();
+    assert(spare == 4'096 - 1'000);
+    v.CommitSize(spare);
+    assert(v.Size() == v.Capacity());
+    v.PushBack(42);
+    assert(v.Size() == 4'097 && v[4'096] == 42);
+}
+
+namespace {
+
+// Компаратор с внешним лимитом сравнений: исчерпание лимита — исключение
+struct BudgetCompare {
+    int* budget;
+    bool operator()(const Obj& l, const Obj& r) const {
+        if (--(*budget) < 0) {
+            throw std::runtime_error("Oops");
+        }
+        return l.id < r.id;
+    }
+};
+
+}  // namespace
+
+void Test29() {
+    {
+        // Пакетная загрузка: псевдослучайные ключи, после Flush порядок полный
+        SortedVector<int> index;
+        std::vector<int> reference;
+        uint32_t seed = 12'345;
+        for (int i = 0; i < 10'000; ++i) {
+            seed = seed * 1'664'525 + 1'013'904'223;
+            const int key = static_cast<int>(seed % 1'000);
+            index.BufferInsert(key);
+            reference.push_back(key);
+        }
+        std::sort(reference.begin(), reference.end());
+        const Vector<int>& items = index.Items();
+        assert(items.Size() == reference.size());
+        for (size_t i = 0; i < reference.size(); ++i) {
+            assert(items[i] == reference[i]);
+        }
+
+        // Branch-free lower bound согласован с std::lower_bound
+        for (int key = -1; key <= 1'000; key += 7) {
+            const size_t expected = std::lower_bound(reference.begin(), reference.end(), key)
+                - reference.begin();
+            assert(index.LowerBoundIndex(key) == expected);
+        }
+        assert(index.Contains(reference[500]));
+        assert(!index.Contains(2'000));
+    }
+    {
+        // Смесь немедленных и пакетных вставок, нетривиальный тип
+        SortedVector<std::string> names;
+        names.InsertSorted("m");
+        names.BufferInsert("z");
+        names.BufferInsert("a");
+        names.InsertSorted("k");
+        const Vector<std::string>& items = names.Items();
+        assert(items.Size() == 4);
+        assert(items[0] == "a" && items[1] == "k" && items[2] == "m" && items[3] == "z");
+    }
+    {
+        // Несколько пакетов подряд: каждый Flush — одно слияние
+        SortedVector<int> v;
+        for (int i = 9; i >= 0; --i) {
+            v.BufferInsert(i * 2);
+        }
+        v.Flush();
+        for (int i = 0; i < 10; ++i) {
+            v.BufferInsert(i * 2 + 1);
+        }
+        const Vector<int>& items = v.Items();
+        for (int i = 0; i < 20; ++i) {
+            assert(items[i] == i);
+        }
+    }
+    {
+        // Бросивший в слиянии компаратор: буфер не течёт, контейнер валиден
+        Obj::ResetCounters();
+        {
+            int budget = 1'000'000;
+            SortedVector<Obj, BudgetCompare> sv(BudgetCompare{&budget});
+            for (int i = 0; i < 8; i += 2) {
+                sv.InsertSorted(Obj(i));
+            }
+            sv.BufferInsert(Obj(3));
+            budget = 1;  // первое сравнение слияния пройдёт, второе бросит
+            bool thrown = false;
+            try {
+                sv.Flush();
+            } catch (const std::runtime_error&) {
+                thrown = true;
+            }
+            assert(thrown);
+            budget = 1'000'000;
+            sv.InsertSorted(Obj(100));
+            assert(sv.Contains(Obj(100)));
+        }
+        assert(Obj::GetAliveObjectCount() == 0);
+    }
+}
+
+void Test30() {
+    {
+        // Тот же прикладной код, что и с Vector: PushBack/Emplace/Erase/итераторы
+        FixedVector<int, 16> v;
+        static_assert(FixedVector<int, 16>::Capacity() == 16);
+        for (int i = 0; i < 10; ++i) {
+            v.PushBack(i);
+        }
+        v.Emplace(v.begin() + 5, 100);
+        assert(v.Size() == 11 && v[5] == 100 && v[6] == 5);
+        v.Erase(v.begin() + 5);
+        assert(v.Size() == 10 && v[5] == 5);
+        int sum = 0;
+        for (int x : v) {
+            sum += x;
+        }
+        assert(sum == 45);
+        v.Resize(3);
+        assert(v.Size() == 3);
+    }
+    {
+        // Нетривиальный тип: копирование, перемещение, разрушение без утечек
+        Obj::ResetCounters();
+        {
+            FixedVector<Obj, 8> v;
+            v.EmplaceBack(1);
+            v.EmplaceBack(2);
+            FixedVector<Obj, 8> copy(v);
+            assert(copy.Size() == 2 && copy[1].id == 2);
+            FixedVector<Obj, 8> moved(std::move(v));
+            assert(moved.Size() == 2 && v.Size() == 0);
+            copy.Swap(moved);
+            assert(Obj::GetAliveObjectCount() == 4);
+        }
+        assert(Obj::GetAliveObjectCount() == 0);
+    }
+}
+
+namespace {
+
+// Деструкторы бегут в фоновом потоке — счётчик обязан быть атомарным
+struct AsyncObj {
+    AsyncObj() {
+        alive.fetch_add(1, std::memory_order_relaxed);
+    }
+    AsyncObj(const AsyncObj&) {
+        alive.fetch_add(1, std::memory_order_relaxed);
+    }
+    AsyncObj(AsyncObj&&) noexcept {
+        alive.fetch_add(1, std::memory_order_relaxed);
+    }
+    ~AsyncObj() {
+        alive.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    inline static std::atomic<int> alive{0};
+};
+
+}  // namespace
+
+void Test31() {
+    {
+        // Нетривиальный тип: элементы дожимаются фоном, вектор сразу пуст
+        Vector<AsyncObj> v;
+        v.Resize(10'000);
+        assert(AsyncObj::alive.load() == 10'000);
+        v.DisposeAsync();
+        assert(v.Size() == 0 && v.Capacity() == 0);
+        v.PushBack(AsyncObj{});
+        assert(v.Size() == 1);
+
+        for (int i = 0; i < 5'000 && AsyncObj::alive.load() != 1; ++i) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        assert(AsyncObj::alive.load() == 1);
+    }
+    {
+        // Тривиальный тип: без деструкторов, буфер освобождается сразу
+        Vector<int> v;
+        v.Resize(100'000);
+        v.DisposeAsync();
+        assert(v.Size() == 0 && v.Capacity() == 0);
+    }
+}
+
+#if defined(ADVANCED_VECTOR_HEAP_HOOKS)
+namespace {
+
+size_t hook_allocated_bytes = 0;
+size_t hook_deallocated_bytes = 0;
+int hook_allocations = 0;
+
+void CountAllocate(std::uintptr_t, size_t bytes) {
+    hook_allocated_bytes += bytes;
+    ++hook_allocations;
+}
+
+void CountDeallocate(std::uintptr_t, size_t bytes) {
+    hook_deallocated_bytes += bytes;
+}
+
+}  // namespace
+#endif
+
+void Test32() {
+#if defined(ADVANCED_VECTOR_HEAP_HOOKS)
+    vector_hooks::on_allocate = CountAllocate;
+    vector_hooks::on_deallocate = CountDeallocate;
+    {
+        Vector<int> v;
+        for (int i = 0; i < 1'000; ++i) {
+            v.PushBack(i);
+        }
+        Vector<Obj> w;
+        w.Resize(100);
+        w.ShrinkToFit();
+    }
+    vector_hooks::on_allocate = nullptr;
+    vector_hooks::on_deallocate = nullptr;
+    // После смерти векторов каждому выделению соответствует освобождение
+    assert(hook_allocations > 0);
+    assert(hook_allocated_bytes == hook_deallocated_bytes);
+#endif
+#if defined(ADVANCED_VECTOR_POISON) && !defined(ADVANCED_VECTOR_HAS_ASAN)
+    {
+        // Без ASan хвост заполняется узором 0xF9 — проверяем байты за size_
+        Vector<unsigned char> v;
+        v.Reserve(64);
+        v.PushBack(0);
+        auto [spare, spare_count] = v.GetSpareCapacity();
+        (void)spare;
+        (void)spare_count;
+        v.PushBack(1);
+        const unsigned char* raw = v.begin();
+        assert(raw[2] == 0xF9 && raw[63] == 0xF9);
+    }
+#endif
+}
+
+void Test33() {
+    // Диапазоны выше порога 2 * detail::kParallelGrain конструируются и
+    // разрушаются параллельно по кускам — прогоняем оба пути
+    const size_t big = 3'000'000;
+    static_assert(big >= 2 * detail::kParallelGrain);
+    {
+        // nothrow-конструируемый тип: value-инициализация идёт по потокам
+        Vector<std::uint64_t> v(big);
+        assert(v.Size() == big);
+        assert(v[0] == 0 && v[big / 2] == 0 && v[big - 1] == 0);
+        v.Resize(3 * big);
+        assert(v[3 * big - 1] == 0);
+        v.Resize(100);
+        assert(v.Size() == 100 && v[99] == 0);
+    }
+    {
+        // Нетривиальный деструктор: разрушение идёт по потокам,
+        // счётчик атомарный — деструкторы бегут конкурентно
+        const int before = AsyncObj::alive.load();
+        Vector<AsyncObj> v;
+        v.Resize(big);
+        assert(AsyncObj::alive.load() == before + static_cast<int>(big));
+        v.ReleaseCapacity();
+        assert(AsyncObj::alive.load() == before);
+    }
+}
+
 int main() {
     try {
         Test1();
@@ -387,6 +1600,34 @@ int main() {
         Test3();
         Test4();
         Test5();
+        Test6();
+        Test7();
+        Test8();
+        Test9();
+        Test10();
+        Test11();
+        Test12();
+        Test13();
+        Test14();
+        Test15();
+        Test16();
+        Test17();
+        Test18();
+        Test19();
+        Test20();
+        Test21();
+        Test22();
+        Test23();
+        Test24();
+        Test25();
+        Test26();
+        Test27();
+        Test28();
+        Test29();
+        Test30();
+        Test31();
+        Test32();
+        Test33();
     } catch (const std::exception& e) {
         std::cerr << e.what() << std::endl;
     }
@@ -0,0 +1,161 @@
+#pragma once
+#include "vector.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <stdexcept>
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// Персистентный режим для тривиально копируемых векторов: SaveToFile пишет
+// содержимое плоским форматом, MappedVector открывает такой файл через mmap —
+// загрузка занимает миллисекунды независимо от размера, страницы подтягиваются
+// лениво и разделяются между процессами.
+
+namespace mapped_detail {
+
+inline constexpr uint64_t kMagic = 0x414456454354'4F52;  // "ADVECTOR"
+
+// Заголовок занимает целую страницу, чтобы данные начинались с выровненного адреса
+struct FileHeader {
+    uint64_t magic;
+    uint64_t count;
+    uint64_t elem_size;
+    unsigned char padding[4096 - 3 * sizeof(uint64_t)];
+};
+static_assert(sizeof(FileHeader) == 4096);
+
+}  // namespace mapped_detail
+
+// Сохраняет вектор в плоский файл, пригодный для MappedVector
+template <typename T, typename Alloc, typename Growth>
+void SaveToFile(const Vector<T, Alloc, Growth>& v, const char* path)
+{
+    static_assert(std::is_trivially_copyable_v<T>,
+        "Плоский формат возможен только для тривиально копируемых типов");
+    std::FILE* f = std::fopen(path, "wb");
+    if (f == nullptr) {
+        throw std::runtime_error("SaveToFile: не удалось открыть файл");
+    }
+    mapped_detail::FileHeader header{};
+    header.magic = mapped_detail::kMagic;
+    header.count = v.Size();
+    header.elem_size = sizeof(T);
+    bool ok = std::fwrite(&header, sizeof(header), 1, f) == 1;
+    if (ok && v.Size() != 0) {
+        ok = std::fwrite(v.begin(), sizeof(T), v.Size(), f) == v.Size();
+    }
+    if (std::fclose(f) != 0 || !ok) {
+        throw std::runtime_error("SaveToFile: ошибка записи");
+    }
+}
+
+// Неизменяемое представление сохранённого вектора поверх mmap файла.
+// Интерфейс чтения совпадает с Vector: begin/end, Size, operator[]
+template <typename T>
+class MappedVector {
+    static_assert(std::is_trivially_copyable_v<T>,
+        "Плоский формат возможен только для тривиально копируемых типов");
+
+public:
+    using const_iterator = const T*;
+
+    explicit MappedVector(const char* path)
+    {
+#if defined(__linux__)
+        const int fd = ::open(path, O_RDONLY);
+        if (fd < 0) {
+            throw std::runtime_error("MappedVector: не удалось открыть файл");
+        }
+        struct stat st {};
+        if (::fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(mapped_detail::FileHeader)) {
+            ::close(fd);
+            throw std::runtime_error("MappedVector: файл повреждён");
+        }
+        mapped_bytes_ = static_cast<size_t>(st.st_size);
+        void* p = ::mmap(nullptr, mapped_bytes_, PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd);  // mmap держит файл сам
+        if (p == MAP_FAILED) {
+            throw std::runtime_error("MappedVector: mmap не удался");
+        }
+        mapping_ = p;
+        const auto* header = static_cast<const mapped_detail::FileHeader*>(p);
+        // Проверка размера — делением: count * sizeof(T) мог бы переполниться,
+        // и испорченный count прошёл бы валидацию
+        if (header->magic != mapped_detail::kMagic || header->elem_size != sizeof(T)
+            || header->count > (mapped_bytes_ - sizeof(mapped_detail::FileHeader)) / sizeof(T)) {
+            ::munmap(mapping_, mapped_bytes_);
+            throw std::runtime_error("MappedVector: неверный формат файла");
+        }
+        size_ = header->count;
+#else
+        (void)path;
+        throw std::runtime_error("MappedVector: поддерживается только на Linux");
+#endif
+    }
+
+    MappedVector(const MappedVector&) = delete;
+    MappedVector& operator=(const MappedVector&) = delete;
+
+    MappedVector(MappedVector&& other) noexcept
+        : mapping_(std::exchange(other.mapping_, nullptr))
+        , mapped_bytes_(std::exchange(other.mapped_bytes_, 0))
+        , size_(std::exchange(other.size_, 0))
+    {
+    }
+
+    ~MappedVector()
+    {
+#if defined(__linux__)
+        if (mapping_ != nullptr) {
+            ::munmap(mapping_, mapped_bytes_);
+        }
+#endif
+    }
+
+    const_iterator begin() const noexcept
+    {
+        return Data();
+    }
+
+    const_iterator end() const noexcept
+    {
+        return Data() + size_;
+    }
+
+    size_t Size() const noexcept
+    {
+        return size_;
+    }
+
+    const T& operator[](size_t index) const noexcept
+    {
+        assert(index < size_);
+        return Data()[index];
+    }
+
+    // Материализует изменяемую копию в обычном векторе
+    template <typename Alloc = std::allocator<T>>
+    Vector<T, Alloc> ToVector(const Alloc& alloc = Alloc()) const
+    {
+        Vector<T, Alloc> v(alloc);
+        v.AppendRange(begin(), end());
+        return v;
+    }
+
+private:
+    const T* Data() const noexcept
+    {
+        return reinterpret_cast<const T*>(
+            static_cast<const unsigned char*>(mapping_) + sizeof(mapped_detail::FileHeader));
+    }
+
+    void* mapping_ = nullptr;
+    size_t mapped_bytes_ = 0;
+    size_t size_ = 0;
+};
@@ -0,0 +1,196 @@
+#pragma once
+#include "vector.h"
+
+// Сегментированный вектор: рост добавляет новый блок фиксированного размера
+// вместо переноса всего содержимого, поэтому худший случай вставки ограничен
+// одним выделением блока — без многомиллисекундных пиков на реаллокации
+// гигантских буферов. Плата — индексация через сдвиг и маску вместо одного
+// сложения у плоского Vector; размер блока степень двойки, так что это две
+// дешёвые операции. Каталог блоков хранится в обычном Vector, его реаллокация
+// двигает лишь дескрипторы блоков, а не элементы
+template <typename T, size_t BlockElems = 1024, typename Alloc = std::allocator<T>>
+class SegmentedVector {
+    static_assert(BlockElems > 0 && (BlockElems & (BlockElems - 1)) == 0,
+        "Размер блока должен быть степенью двойки");
+
+public:
+    SegmentedVector() = default;
+
+    explicit SegmentedVector(const Alloc& alloc) noexcept
+        : alloc_(alloc)
+    {
+    }
+
+    SegmentedVector(const SegmentedVector&) = delete;
+    SegmentedVector& operator=(const SegmentedVector&) = delete;
+
+    SegmentedVector(SegmentedVector&& other) noexcept
+        : alloc_(std::move(other.alloc_))
+        , blocks_(std::move(other.blocks_))
+        , size_(std::exchange(other.size_, 0))
+    {
+    }
+
+    SegmentedVector& operator=(SegmentedVector&& rhs) noexcept
+    {
+        if (this != &rhs) {
+            DestroyAll();
+            alloc_ = std::move(rhs.alloc_);
+            blocks_ = std::move(rhs.blocks_);
+            size_ = std::exchange(rhs.size_, 0);
+        }
+        return *this;
+    }
+
+    ~SegmentedVector()
+    {
+        DestroyAll();
+    }
+
+    size_t Size() const noexcept
+    {
+        return size_;
+    }
+
+    size_t Capacity() const noexcept
+    {
+        return blocks_.Size() * BlockElems;
+    }
+
+    const T& operator[](size_t index) const noexcept
+    {
+        return const_cast<SegmentedVector&>(*this)[index];
+    }
+
+    T& operator[](size_t index) noexcept
+    {
+        assert(index < size_);
+        return blocks_[index >> kShift][index & kMask];
+    }
+
+    // Донарезает блоки под new_capacity элементов; существующие элементы не двигаются
+    void Reserve(size_t new_capacity)
+    {
+        while (Capacity() < new_capacity) {
+            AppendBlock();
+        }
+    }
+
+    void PushBack(const T& value)
+    {
+        EmplaceBack(value);
+    }
+
+    void PushBack(T&& value)
+    {
+        EmplaceBack(std::move(value));
+    }
+
+    template <typename... Args>
+    T& EmplaceBack(Args&&... args)
+    {
+        if (size_ == Capacity()) {
+            AppendBlock();
+        }
+        T* result = new (BlockFor(size_) + (size_ & kMask)) T(std::forward<Args>(args)...);
+        ++size_;
+        return *result;
+    }
+
+    void PopBack() noexcept
+    {
+        assert(size_ > 0);
+        --size_;
+        std::destroy_at(BlockFor(size_) + (size_ & kMask));
+    }
+
+    // Пустые хвостовые блоки возвращаются аллокатору
+    void ShrinkToFit()
+    {
+        const size_t needed = (size_ + BlockElems - 1) / BlockElems;
+        while (blocks_.Size() > needed) {
+            blocks_.PopBack();
+        }
+    }
+
+    class Iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = T*;
+        using reference = T&;
+
+        Iterator(SegmentedVector* owner, size_t index) noexcept
+            : owner_(owner)
+            , index_(index)
+        {
+        }
+
+        reference operator*() const noexcept
+        {
+            return (*owner_)[index_];
+        }
+
+        Iterator& operator++() noexcept
+        {
+            ++index_;
+            return *this;
+        }
+
+        bool operator==(const Iterator& rhs) const noexcept
+        {
+            return index_ == rhs.index_;
+        }
+
+        bool operator!=(const Iterator& rhs) const noexcept
+        {
+            return !(*this == rhs);
+        }
+
+    private:
+        SegmentedVector* owner_;
+        size_t index_;
+    };
+
+    Iterator begin() noexcept
+    {
+        return Iterator(this, 0);
+    }
+
+    Iterator end() noexcept
+    {
+        return Iterator(this, size_);
+    }
+
+private:
+    static constexpr size_t Log2(size_t n) noexcept
+    {
+        return n == 1 ? 0 : 1 + Log2(n / 2);
+    }
+
+    static constexpr size_t kShift = Log2(BlockElems);
+    static constexpr size_t kMask = BlockElems - 1;
+
+    T* BlockFor(size_t index) noexcept
+    {
+        return blocks_[index >> kShift].GetAddress();
+    }
+
+    void AppendBlock()
+    {
+        blocks_.PushBack(RawMemory<T, Alloc>(BlockElems, alloc_));
+    }
+
+    void DestroyAll() noexcept
+    {
+        for (size_t i = 0; i < size_; i += BlockElems) {
+            detail::DestroyN(BlockFor(i), std::min(BlockElems, size_ - i));
+        }
+        size_ = 0;
+    }
+
+    Alloc alloc_;
+    Vector<RawMemory<T, Alloc>> blocks_;
+    size_t size_ = 0;
+};
@@ -0,0 +1,262 @@
+#pragma once
+#include "vector.h"
+
+// Вектор с маленьким встроенным буфером (small-buffer optimization).
+// До N элементов хранятся прямо в объекте без обращения к куче; при переполнении
+// содержимое переезжает в RawMemory, и дальше контейнер ведёт себя как Vector.
+template <typename T, size_t N, typename Alloc = std::allocator<T>>
+class SmallVector {
+    static_assert(N > 0, "Встроенная ёмкость должна быть больше нуля");
+
+public:
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    iterator begin() noexcept
+    {
+        return Data();
+    }
+
+    iterator end() noexcept
+    {
+        return Data() + size_;
+    }
+
+    const_iterator begin() const noexcept
+    {
+        return Data();
+    }
+
+    const_iterator end() const noexcept
+    {
+        return Data() + size_;
+    }
+
+    const_iterator cbegin() const noexcept
+    {
+        return begin();
+    }
+
+    const_iterator cend() const noexcept
+    {
+        return end();
+    }
+
+    SmallVector() = default;
+
+    explicit SmallVector(const Alloc& alloc) noexcept
+        :heap_(alloc)
+    {
+    }
+
+    explicit SmallVector(size_t size, const Alloc& alloc = Alloc())
+        :heap_(alloc)
+    {
+        Reserve(size);
+        std::uninitialized_value_construct_n(Data(), size);
+        size_ = size;
+    }
+
+    SmallVector(const SmallVector& other)
+        :heap_(std::allocator_traits<Alloc>::select_on_container_copy_construction(other.heap_.GetAllocator()))
+    {
+        Reserve(other.size_);
+        std::uninitialized_copy_n(other.Data(), other.size_, Data());
+        size_ = other.size_;
+    }
+
+    SmallVector(SmallVector&& other) noexcept(detail::kIsNothrowRelocatable<T>)
+    {
+        if (!other.IsInline()) {
+            heap_ = std::move(other.heap_);
+        }
+        else {
+            detail::RelocateN(other.Data(), other.size_, Data());
+            detail::DestroyRelocatedN(other.Data(), other.size_);
+        }
+        size_ = std::exchange(other.size_, 0);
+    }
+
+    SmallVector& operator=(const SmallVector& rhs)
+    {
+        if (this != &rhs) {
+            if (Capacity() < rhs.size_) {
+                SmallVector rhs_copy(rhs);
+                Swap(rhs_copy);
+            }
+            else {
+                std::copy(rhs.Data(), rhs.Data() + std::min(rhs.size_, size_), Data());
+                if (rhs.size_ < size_) {
+                    std::destroy_n(Data() + rhs.size_, size_ - rhs.size_);
+                }
+                else {
+                    std::uninitialized_copy_n(rhs.Data() + size_, rhs.size_ - size_, Data() + size_);
+                }
+                size_ = rhs.size_;
+            }
+        }
+        return *this;
+    }
+
+    SmallVector& operator=(SmallVector&& rhs) noexcept(detail::kIsNothrowRelocatable<T>)
+    {
+        if (this != &rhs) {
+            std::destroy_n(Data(), size_);
+            if (!rhs.IsInline()) {
+                heap_ = std::move(rhs.heap_);
+                size_ = std::exchange(rhs.size_, 0);
+            }
+            else {
+                // Ёмкость всегда не меньше N, поэтому содержимое встроенного буфера помещается
+                detail::RelocateN(rhs.Data(), rhs.size_, Data());
+                detail::DestroyRelocatedN(rhs.Data(), rhs.size_);
+                size_ = std::exchange(rhs.size_, 0);
+            }
+        }
+        return *this;
+    }
+
+    ~SmallVector()
+    {
+        std::destroy_n(Data(), size_);
+    }
+
+    bool IsInline() const noexcept
+    {
+        return heap_.GetAddress() == nullptr;
+    }
+
+    size_t Size() const noexcept
+    {
+        return size_;
+    }
+
+    size_t Capacity() const noexcept
+    {
+        return IsInline() ? N : heap_.Capacity();
+    }
+
+    const T& operator[](size_t index) const noexcept
+    {
+        return const_cast<SmallVector&>(*this)[index];
+    }
+
+    T& operator[](size_t index) noexcept
+    {
+        assert(index < size_);
+        return Data()[index];
+    }
+
+    void Reserve(size_t new_capacity)
+    {
+        if (new_capacity <= Capacity()) {
+            return;
+        }
+        RawMemory<T, Alloc> new_data(new_capacity, heap_.GetAllocator());
+        detail::RelocateN(Data(), size_, new_data.GetAddress());
+        detail::DestroyRelocatedN(Data(), size_);
+        heap_ = std::move(new_data);
+    }
+
+    void Swap(SmallVector& other) noexcept(detail::kIsNothrowRelocatable<T>&& std::is_nothrow_swappable_v<T>)
+    {
+        if (!IsInline() && !other.IsInline()) {
+            heap_.Swap(other.heap_);
+            std::swap(size_, other.size_);
+        }
+        else if (IsInline() && other.IsInline()) {
+            SmallVector& shorter = size_ < other.size_ ? *this : other;
+            SmallVector& longer = size_ < other.size_ ? other : *this;
+            std::swap_ranges(shorter.Data(), shorter.Data() + shorter.size_, longer.Data());
+            detail::RelocateN(longer.Data() + shorter.size_, longer.size_ - shorter.size_,
+                shorter.Data() + shorter.size_);
+            detail::DestroyRelocatedN(longer.Data() + shorter.size_, longer.size_ - shorter.size_);
+            std::swap(size_, other.size_);
+        }
+        else {
+            SmallVector& inl = IsInline() ? *this : other;
+            SmallVector& heap = IsInline() ? other : *this;
+            // Забираем кучевой буфер, а встроенные элементы переезжают в чужой встроенный буфер
+            RawMemory<T, Alloc> buf = std::move(heap.heap_);
+            detail::RelocateN(inl.Data(), inl.size_, heap.InlineData());
+            detail::DestroyRelocatedN(inl.Data(), inl.size_);
+            inl.heap_ = std::move(buf);
+            std::swap(size_, other.size_);
+        }
+    }
+
+    void Resize(size_t new_size)
+    {
+        if (new_size < size_) {
+            std::destroy_n(Data() + new_size, size_ - new_size);
+        }
+        else {
+            if (new_size > Capacity()) {
+                const size_t new_capacity = std::max(new_size, Capacity() * 2);
+                Reserve(new_capacity);
+            }
+            std::uninitialized_value_construct_n(Data() + size_, new_size - size_);
+        }
+        size_ = new_size;
+    }
+
+    void PushBack(const T& value)
+    {
+        EmplaceBack(value);
+    }
+
+    void PushBack(T&& value)
+    {
+        EmplaceBack(std::move(value));
+    }
+
+    template <typename... Args>
+    T& EmplaceBack(Args&&... args)
+    {
+        T* result = nullptr;
+        if (size_ == Capacity()) {
+            RawMemory<T, Alloc> new_data(size_ * 2, heap_.GetAllocator());
+            result = new(new_data + size_) T(std::forward<Args>(args)...);
+            detail::RelocateN(Data(), size_, new_data.GetAddress());
+            detail::DestroyRelocatedN(Data(), size_);
+            heap_ = std::move(new_data);
+        }
+        else {
+            result = new(Data() + size_) T(std::forward<Args>(args)...);
+        }
+        ++size_;
+        return *result;
+    }
+
+    void PopBack() noexcept {
+        if (size_ > 0) {
+            std::destroy_at(Data() + size_ - 1);
+            --size_;
+        }
+    }
+
+private:
+    T* InlineData() noexcept
+    {
+        return reinterpret_cast<T*>(inline_buf_);
+    }
+
+    const T* InlineData() const noexcept
+    {
+        return reinterpret_cast<const T*>(inline_buf_);
+    }
+
+    T* Data() noexcept
+    {
+        return IsInline() ? InlineData() : heap_.GetAddress();
+    }
+
+    const T* Data() const noexcept
+    {
+        return IsInline() ? InlineData() : heap_.GetAddress();
+    }
+
+    alignas(T) unsigned char inline_buf_[N * sizeof(T)];
+    RawMemory<T, Alloc> heap_;
+    size_t size_ = 0;
+};
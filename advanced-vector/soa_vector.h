@@ -0,0 +1,215 @@
+#pragma once
+#include "vector.h"
+
+#include <tuple>
+
+// Structure-of-arrays вариант вектора: каждое поле записи лежит в собственном
+// непрерывном столбце поверх отдельного RawMemory, а размер и ёмкость общие.
+// Скан одного поля читает кеш-линии без балласта соседних полей и спокойно
+// векторизуется. Рост идёт той же политикой, что и у Vector::Reserve.
+// Конструкторы полей предполагаются небросающими (числовые колонки аналитики);
+// при исключении в середине строки контейнер даёт только базовую гарантию
+template <typename... Fields>
+class SoaVector {
+    static_assert(sizeof...(Fields) > 0, "Нужно хотя бы одно поле");
+
+public:
+    template <size_t I>
+    using FieldType = std::tuple_element_t<I, std::tuple<Fields...>>;
+
+    SoaVector() = default;
+
+    SoaVector(const SoaVector& other)
+    {
+        Reserve(other.size_);
+        CopyColumns(other, std::index_sequence_for<Fields...>{});
+        size_ = other.size_;
+    }
+
+    SoaVector(SoaVector&& other) noexcept
+        : buffers_(std::move(other.buffers_))
+        , size_(std::exchange(other.size_, 0))
+        , capacity_(std::exchange(other.capacity_, 0))
+    {
+    }
+
+    SoaVector& operator=(const SoaVector& rhs)
+    {
+        if (this != &rhs) {
+            SoaVector rhs_copy(rhs);
+            Swap(rhs_copy);
+        }
+        return *this;
+    }
+
+    SoaVector& operator=(SoaVector&& rhs) noexcept
+    {
+        if (this != &rhs) {
+            DestroyColumns(std::index_sequence_for<Fields...>{});
+            buffers_ = std::move(rhs.buffers_);
+            size_ = std::exchange(rhs.size_, 0);
+            capacity_ = std::exchange(rhs.capacity_, 0);
+        }
+        return *this;
+    }
+
+    ~SoaVector()
+    {
+        DestroyColumns(std::index_sequence_for<Fields...>{});
+    }
+
+    size_t Size() const noexcept
+    {
+        return size_;
+    }
+
+    size_t Capacity() const noexcept
+    {
+        return capacity_;
+    }
+
+    void Swap(SoaVector& other) noexcept
+    {
+        std::swap(buffers_, other.buffers_);
+        std::swap(size_, other.size_);
+        std::swap(capacity_, other.capacity_);
+    }
+
+    void Reserve(size_t new_capacity)
+    {
+        if (new_capacity <= capacity_) {
+            return;
+        }
+        GrowColumns(new_capacity, std::index_sequence_for<Fields...>{});
+        capacity_ = new_capacity;
+    }
+
+    // Добавляет строку: по одному значению на каждое поле
+    void PushBack(const Fields&... values)
+    {
+        EmplaceBack(values...);
+    }
+
+    template <typename... Args>
+    void EmplaceBack(Args&&... args)
+    {
+        static_assert(sizeof...(Args) == sizeof...(Fields),
+            "Нужно ровно по одному значению на каждое поле");
+        if (size_ == capacity_) {
+            // args могут ссылаться на собственные столбцы — новая строка
+            // конструируется в свежие буферы до освобождения старых,
+            // как в реаллоцирующей ветке Vector::EmplaceBack
+            const size_t new_capacity = NextCapacity(size_ + 1);
+            std::tuple<RawMemory<Fields>...> new_buffers{RawMemory<Fields>(new_capacity)...};
+            ConstructRowInto(new_buffers, std::index_sequence_for<Fields...>{},
+                std::forward<Args>(args)...);
+            RelocateColumnsInto(new_buffers, std::index_sequence_for<Fields...>{});
+            std::swap(buffers_, new_buffers);
+            capacity_ = new_capacity;
+        }
+        else {
+            ConstructRowInto(buffers_, std::index_sequence_for<Fields...>{},
+                std::forward<Args>(args)...);
+        }
+        ++size_;
+    }
+
+    void PopBack() noexcept
+    {
+        assert(size_ > 0);
+        --size_;
+        DestroyRow(size_, std::index_sequence_for<Fields...>{});
+    }
+
+    // Указатель на начало столбца поля I; столбец непрерывен, длина — Size()
+    template <size_t I>
+    FieldType<I>* Column() noexcept
+    {
+        return std::get<I>(buffers_).GetAddress();
+    }
+
+    template <size_t I>
+    const FieldType<I>* Column() const noexcept
+    {
+        return std::get<I>(buffers_).GetAddress();
+    }
+
+    template <size_t I>
+    FieldType<I>& Get(size_t row) noexcept
+    {
+        assert(row < size_);
+        return Column<I>()[row];
+    }
+
+    template <size_t I>
+    const FieldType<I>& Get(size_t row) const noexcept
+    {
+        assert(row < size_);
+        return Column<I>()[row];
+    }
+
+private:
+    // Суммарный размер строки — чтобы страничные политики считали байты честно
+    static constexpr size_t kRowBytes = (sizeof(Fields) + ...);
+
+    size_t NextCapacity(size_t required) const
+    {
+        return std::max(required, GrowthDoubling::Next(capacity_, required, kRowBytes));
+    }
+
+    template <size_t I>
+    void GrowColumn(size_t new_capacity)
+    {
+        auto& buf = std::get<I>(buffers_);
+        RawMemory<FieldType<I>> new_data(new_capacity);
+        detail::RelocateN(buf.GetAddress(), size_, new_data.GetAddress());
+        detail::DestroyRelocatedN(buf.GetAddress(), size_);
+        buf.Swap(new_data);
+    }
+
+    template <size_t... I>
+    void GrowColumns(size_t new_capacity, std::index_sequence<I...>)
+    {
+        (GrowColumn<I>(new_capacity), ...);
+    }
+
+    // Конструирует строку с индексом size_ в переданных столбцах — при росте
+    // это ещё не принятые new_buffers, при дозаписи — собственные buffers_
+    template <size_t... I, typename... Args>
+    void ConstructRowInto(std::tuple<RawMemory<Fields>...>& bufs, std::index_sequence<I...>,
+        Args&&... args)
+    {
+        (::new (static_cast<void*>(std::get<I>(bufs).GetAddress() + size_))
+            FieldType<I>(std::forward<Args>(args)), ...);
+    }
+
+    // Переносит живые столбцы в новые буферы и разрушает перенесённое
+    template <size_t... I>
+    void RelocateColumnsInto(std::tuple<RawMemory<Fields>...>& bufs, std::index_sequence<I...>)
+    {
+        ((detail::RelocateN(Column<I>(), size_, std::get<I>(bufs).GetAddress()),
+            detail::DestroyRelocatedN(Column<I>(), size_)), ...);
+    }
+
+    template <size_t... I>
+    void DestroyRow(size_t row, std::index_sequence<I...>) noexcept
+    {
+        (std::destroy_at(Column<I>() + row), ...);
+    }
+
+    template <size_t... I>
+    void DestroyColumns(std::index_sequence<I...>) noexcept
+    {
+        (detail::DestroyN(Column<I>(), size_), ...);
+    }
+
+    template <size_t... I>
+    void CopyColumns(const SoaVector& other, std::index_sequence<I...>)
+    {
+        (std::uninitialized_copy_n(other.Column<I>(), other.size_, Column<I>()), ...);
+    }
+
+    std::tuple<RawMemory<Fields>...> buffers_;
+    size_t size_ = 0;
+    size_t capacity_ = 0;
+};
@@ -0,0 +1,126 @@
+#pragma once
+#include "vector.h"
+
+#include <functional>
+
+// Сортированный индекс поверх Vector. Одиночный InsertSorted встаёт на своё
+// место сразу, а массовая загрузка идёт через BufferInsert: ключи копятся в
+// пакете, пакет сортируется и вливается в основу одним обратным проходом —
+// вместо квадратичного сдвига хвоста на каждую вставку. Поиск — lower bound
+// без ветвлений: условный сдвиг базы компилируется в cmov, и предсказатель
+// переходов не участвует. Перемещения T предполагаются небросающими;
+// бросивший компаратор оставляет контейнер валидным, но с неопределённым
+// содержимым (базовая гарантия)
+template <typename T, typename Compare = std::less<T>>
+class SortedVector {
+public:
+    using const_iterator = const T*;
+
+    SortedVector() = default;
+
+    explicit SortedVector(Compare comp)
+        : comp_(std::move(comp))
+    {
+    }
+
+    // Всего элементов, включая ещё не влитый пакет
+    size_t Size() const noexcept
+    {
+        return base_.Size() + pending_.Size();
+    }
+
+    // Немедленная вставка с сохранением порядка
+    void InsertSorted(T value)
+    {
+        Flush();
+        const size_t pos = LowerBoundIndex(value);
+        base_.Insert(base_.begin() + pos, std::move(value));
+    }
+
+    // Откладывает ключ в пакет; порядок восстановит ближайший Flush
+    void BufferInsert(T value)
+    {
+        pending_.PushBack(std::move(value));
+    }
+
+    // Вливает пакет в основу: сортировка пакета и один обратный проход слияния.
+    // Большие элементы падают в конец, хвост основы не сдвигается по разу на ключ
+    void Flush()
+    {
+        if (pending_.Size() == 0) {
+            return;
+        }
+        std::sort(pending_.begin(), pending_.end(), comp_);
+        const size_t add = pending_.Size();
+        base_.Reserve(base_.Size() + add);
+        size_t old = 0;
+        size_t capacity = 0;
+        T* buf = base_.Release(old, capacity);
+        size_t i = old;
+        size_t j = add;
+        size_t target = old + add;
+        try {
+            while (j > 0) {
+                --target;
+                const bool from_base = i > 0 && comp_(pending_[j - 1], buf[i - 1]);
+                T& src = from_base ? buf[i - 1] : pending_[j - 1];
+                if (target >= old) {
+                    new (buf + target) T(std::move(src));
+                }
+                else {
+                    buf[target] = std::move(src);
+                }
+                i -= from_base ? 1 : 0;
+                j -= from_base ? 0 : 1;
+            }
+        }
+        catch (...) {
+            // Компаратор бросил на полпути: разрушаем достроенный хвост и
+            // возвращаем буфер вектору с прежним размером. Контейнер остаётся
+            // валидным, содержимое не определено (базовая гарантия), утечек нет
+            const size_t constructed = std::max(old, target + 1);
+            std::destroy_n(buf + constructed, old + add - constructed);
+            base_ = Vector<T>::Adopt(buf, old, capacity);
+            pending_.Resize(0);
+            throw;
+        }
+        base_ = Vector<T>::Adopt(buf, old + add, capacity);
+        pending_.Resize(0);
+    }
+
+    // Индекс первого элемента, не меньшего key. Вливает отложенный пакет
+    size_t LowerBoundIndex(const T& key)
+    {
+        Flush();
+        const T* arr = base_.begin();
+        const T* low = arr;
+        size_t len = base_.Size();
+        if (len == 0) {
+            return 0;
+        }
+        while (len > 1) {
+            const size_t half = len / 2;
+            low = comp_(low[half - 1], key) ? low + half : low;
+            len -= half;
+        }
+        return (low - arr) + (comp_(*low, key) ? 1 : 0);
+    }
+
+    bool Contains(const T& key)
+    {
+        const size_t pos = LowerBoundIndex(key);
+        return pos < base_.Size() && !comp_(key, base_[pos]);
+    }
+
+    // Отсортированное содержимое; отложенный пакет вливается перед выдачей
+    const Vector<T>& Items()
+    {
+        Flush();
+        return base_;
+    }
+
+private:
+    Compare comp_;
+    Vector<T> base_;
+    Vector<T> pending_;
+};
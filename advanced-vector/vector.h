@@ -1,22 +1,133 @@
 #pragma once
 #include <cassert>
+#include <cstddef>
+#include <cstdint>
 #include <cstdlib>
+#include <cstring>
+#include <algorithm>
+#include <iterator>
 #include <new>
+#include <thread>
 #include <utility>
 #include <memory>
 
-template <typename T>
+// Хуки для атрибуции кучи: сборка с -DADVANCED_VECTOR_HEAP_HOOKS сообщает
+// каждое выделение и освобождение RawMemory в подключаемый колбэк — профайлер
+// видит, какие векторы держат память. Без макроса вызовы исчезают при компиляции
+namespace vector_hooks {
+
+#if defined(ADVANCED_VECTOR_HEAP_HOOKS)
+// Адрес передаётся числом: хуку он нужен только как ключ для учёта, а после
+// realloc или free сам указатель трогать уже нельзя
+using HeapHook = void (*)(std::uintptr_t address, size_t bytes);
+
+inline HeapHook on_allocate = nullptr;
+inline HeapHook on_deallocate = nullptr;
+#endif
+
+inline void NotifyAllocate(const void* buffer, size_t bytes) noexcept {
+#if defined(ADVANCED_VECTOR_HEAP_HOOKS)
+    if (on_allocate != nullptr) {
+        on_allocate(reinterpret_cast<std::uintptr_t>(buffer), bytes);
+    }
+#else
+    (void)buffer;
+    (void)bytes;
+#endif
+}
+
+inline void NotifyDeallocate(const void* buffer, size_t bytes) noexcept {
+#if defined(ADVANCED_VECTOR_HEAP_HOOKS)
+    if (on_deallocate != nullptr) {
+        on_deallocate(reinterpret_cast<std::uintptr_t>(buffer), bytes);
+    }
+#else
+    (void)buffer;
+    (void)bytes;
+#endif
+}
+
+}  // namespace vector_hooks
+
+// Отравление незанятого хвоста [size_, capacity_): сборка с
+// -DADVANCED_VECTOR_POISON помечает его для ASan, и чтение мимо size_
+// ловится сразу, без полной санитайзерной сборки всего приложения.
+// Без ASan хвост заполняется байтовым узором — мусор хотя бы детерминирован
+#if defined(ADVANCED_VECTOR_POISON)
+#if defined(__SANITIZE_ADDRESS__)
+#define ADVANCED_VECTOR_HAS_ASAN 1
+#elif defined(__has_feature)
+#if __has_feature(address_sanitizer)
+#define ADVANCED_VECTOR_HAS_ASAN 1
+#endif
+#endif
+#if defined(ADVANCED_VECTOR_HAS_ASAN)
+#include <sanitizer/asan_interface.h>
+#endif
+#endif
+
+namespace detail {
+
+inline void PoisonRegion(void* p, size_t bytes) noexcept {
+#if defined(ADVANCED_VECTOR_HAS_ASAN)
+    __asan_poison_memory_region(p, bytes);
+#elif defined(ADVANCED_VECTOR_POISON)
+    std::memset(p, 0xF9, bytes);
+#else
+    (void)p;
+    (void)bytes;
+#endif
+}
+
+inline void UnpoisonRegion(void* p, size_t bytes) noexcept {
+#if defined(ADVANCED_VECTOR_HAS_ASAN)
+    __asan_unpoison_memory_region(p, bytes);
+#else
+    (void)p;
+    (void)bytes;
+#endif
+}
+
+}  // namespace detail
+
+template <typename T, typename Alloc = std::allocator<T>>
 class RawMemory {
 public:
+    using AllocTraits = std::allocator_traits<Alloc>;
+
     RawMemory() = default;
 
-    explicit RawMemory(size_t capacity)
-        : buffer_(Allocate(capacity))
+    explicit RawMemory(const Alloc& alloc) noexcept
+        : alloc_(alloc) {
+    }
+
+    explicit RawMemory(size_t capacity, const Alloc& alloc = Alloc())
+        : alloc_(alloc)
+        , buffer_(Allocate(capacity))
         , capacity_(capacity) {
     }
 
+    RawMemory(const RawMemory&) = delete;
+    RawMemory& operator=(const RawMemory&) = delete;
+
+    RawMemory(RawMemory&& other) noexcept
+        : alloc_(std::move(other.alloc_))
+        , buffer_(std::exchange(other.buffer_, nullptr))
+        , capacity_(std::exchange(other.capacity_, 0)) {
+    }
+
+    RawMemory& operator=(RawMemory&& other) noexcept {
+        if (this != &other) {
+            Deallocate(buffer_, capacity_);
+            alloc_ = std::move(other.alloc_);
+            buffer_ = std::exchange(other.buffer_, nullptr);
+            capacity_ = std::exchange(other.capacity_, 0);
+        }
+        return *this;
+    }
+
     ~RawMemory() {
-        Deallocate(buffer_);
+        Deallocate(buffer_, capacity_);
     }
 
     T* operator+(size_t offset) noexcept {
@@ -39,6 +150,13 @@ public:
     }
 
     void Swap(RawMemory& other) noexcept {
+        if constexpr (AllocTraits::propagate_on_container_swap::value) {
+            std::swap(alloc_, other.alloc_);
+        }
+        else if constexpr (!AllocTraits::is_always_equal::value) {
+            // Обмен без распространения аллокатора допустим только для равных аллокаторов
+            assert(alloc_ == other.alloc_);
+        }
         std::swap(buffer_, other.buffer_);
         std::swap(capacity_, other.capacity_);
     }
@@ -55,25 +173,365 @@ public:
         return capacity_;
     }
 
+    Alloc& GetAllocator() noexcept {
+        return alloc_;
+    }
+
+    const Alloc& GetAllocator() const noexcept {
+        return alloc_;
+    }
+
+    // Принимает чужой буфер во владение, освободив свой. Буфер обязан быть
+    // выделен совместимо с Allocate: malloc для realloc-пути, иначе тем же аллокатором
+    void Adopt(T* buf, size_t capacity) noexcept {
+        Deallocate(buffer_, capacity_);
+        buffer_ = buf;
+        capacity_ = capacity;
+    }
+
+    // Отдаёт буфер наружу, не освобождая его; RawMemory становится пустой
+    T* Release() noexcept {
+        capacity_ = 0;
+        return std::exchange(buffer_, nullptr);
+    }
+
+    // Пытается расширить блок на месте в духе realloc. Возможно только для
+    // тривиально копируемых типов со стандартным аллокатором: такие буферы
+    // выделяются через malloc, и realloc либо продлит блок, либо перенесёт
+    // его побайтово сам — в обоих случаях копирование в Reserve не нужно
+    bool TryGrow(size_t new_capacity) {
+        if constexpr (kUsesRealloc) {
+            if (new_capacity <= capacity_) {
+                return true;
+            }
+            if (buffer_ == nullptr) {
+                return false;
+            }
+            // Старый адрес снимается в число до realloc: хуку он нужен только
+            // как ключ для учёта. GCC всё равно видит в нём бывший указатель
+            // и даёт ложный -Wuse-after-free — глушим точечно
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuse-after-free"
+#endif
+            const auto old_address = reinterpret_cast<std::uintptr_t>(buffer_);
+            T* new_buffer = static_cast<T*>(std::realloc(static_cast<void*>(buffer_), new_capacity * sizeof(T)));
+            if (new_buffer == nullptr) {
+                throw std::bad_alloc{};
+            }
+            vector_hooks::NotifyDeallocate(reinterpret_cast<const void*>(old_address), capacity_ * sizeof(T));
+            vector_hooks::NotifyAllocate(new_buffer, new_capacity * sizeof(T));
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+            buffer_ = new_buffer;
+            capacity_ = new_capacity;
+            return true;
+        }
+        else {
+            return false;
+        }
+    }
+
 private:
+    static constexpr bool kUsesRealloc = std::is_trivially_copyable_v<T>
+        && std::is_same_v<Alloc, std::allocator<T>>
+        && alignof(T) <= alignof(std::max_align_t);
+
     // Выделяет сырую память под n элементов и возвращает указатель на неё
-    static T* Allocate(size_t n) {
-        return n != 0 ? static_cast<T*>(operator new(n * sizeof(T))) : nullptr;
+    T* Allocate(size_t n) {
+        if (n == 0) {
+            return nullptr;
+        }
+        T* buf = nullptr;
+        if constexpr (kUsesRealloc) {
+            buf = static_cast<T*>(std::malloc(n * sizeof(T)));
+            if (buf == nullptr) {
+                throw std::bad_alloc{};
+            }
+        }
+        else {
+            buf = AllocTraits::allocate(alloc_, n);
+        }
+        vector_hooks::NotifyAllocate(buf, n * sizeof(T));
+        return buf;
     }
 
     // Освобождает сырую память, выделенную ранее по адресу buf при помощи Allocate
-    static void Deallocate(T* buf) noexcept {
-        operator delete(buf);
+    void Deallocate(T* buf, size_t n) noexcept {
+        if (buf != nullptr) {
+            vector_hooks::NotifyDeallocate(buf, n * sizeof(T));
+            // Снимаем возможное отравление: буфер возвращается аллокатору чистым
+            detail::UnpoisonRegion(static_cast<void*>(buf), n * sizeof(T));
+            if constexpr (kUsesRealloc) {
+                std::free(buf);
+            }
+            else {
+                AllocTraits::deallocate(alloc_, buf, n);
+            }
+        }
     }
 
+    Alloc alloc_;
     T* buffer_ = nullptr;
     size_t capacity_ = 0;
 };
 
 
+// Типы, которые можно переносить в новый буфер простым копированием байт,
+// без вызова move-конструктора и деструктора источника. По умолчанию это
+// тривиально копируемые типы; для своих memcpy-переносимых типов (строки с
+// указателем на кучу и т.п.) трейт можно специализировать
+template <typename T>
+struct IsTriviallyRelocatable : std::is_trivially_copyable<T> {};
+
 template <typename T>
+inline constexpr bool kIsTriviallyRelocatable = IsTriviallyRelocatable<T>::value;
+
+namespace detail {
+
+// Перенос n элементов не бросит исключений: либо это плоское копирование байт,
+// либо nothrow-перемещение, либо тип вообще нельзя копировать и выбора нет
+template <typename T>
+inline constexpr bool kIsNothrowRelocatable = ::kIsTriviallyRelocatable<T>
+    || std::is_nothrow_move_constructible_v<T>
+    || !std::is_copy_constructible_v<T>;
+
+// Переносит n элементов из src в неинициализированную память dst.
+// Для memcpy-переносимых типов — один memcpy, иначе перемещение
+// либо копирование по той же схеме, что и раньше в Reserve.
+// AssumeNothrow объявляет перемещение небросающим независимо от noexcept
+// на конструкторе — копирующий запасной путь тогда не рассматривается
+template <bool AssumeNothrow = false, typename T>
+void RelocateN(T* src, size_t n, T* dst) {
+    if constexpr (::kIsTriviallyRelocatable<T>) {
+        if (n != 0) {
+            // Через void*: memcpy для типов с нетривиальным move — осознанный перенос владения
+            std::memcpy(static_cast<void*>(dst), static_cast<const void*>(src), n * sizeof(T));
+        }
+    }
+    else if constexpr (AssumeNothrow || std::is_nothrow_move_constructible_v<T>
+        || !std::is_copy_constructible_v<T>) {
+        std::uninitialized_move_n(src, n, dst);
+    }
+    else {
+        std::uninitialized_copy_n(src, n, dst);
+    }
+}
+
+// Перезаписывает n живых элементов значением value. Нулевой байтовый образ
+// тривиально копируемого типа схлопывается в memset; остальные тривиальные
+// типы заполняются плоским циклом по сырому буферу, который компилятор
+// векторизует без помех от вызовов через operator[]
+template <typename T>
+void FillN(T* buf, size_t n, const T& value) {
+    if constexpr (std::is_trivially_copyable_v<T>) {
+        if (n != 0) {
+            unsigned char zero_image[sizeof(T)] = {};
+            if (std::memcmp(&value, zero_image, sizeof(T)) == 0) {
+                std::memset(static_cast<void*>(buf), 0, n * sizeof(T));
+                return;
+            }
+        }
+    }
+    std::fill_n(buf, n, value);
+}
+
+// Минимальный кусок работы на поток: ниже него распараллеливание не окупается
+inline constexpr size_t kParallelGrain = size_t{1} << 20;
+inline constexpr size_t kMaxParallelThreads = 64;
+
+// Разбивает диапазон [0, count) на куски и обрабатывает их в нескольких потоках.
+// fn(begin, len) обязана не бросать исключений. Куски, под которые не удалось
+// создать поток, обрабатываются на вызывающем потоке
+template <typename Fn>
+void RunChunked(size_t count, const Fn& fn) {
+    size_t workers = std::thread::hardware_concurrency();
+    workers = std::min({workers, kMaxParallelThreads, count / kParallelGrain});
+    if (workers <= 1) {
+        fn(size_t{0}, count);
+        return;
+    }
+    const size_t chunk = (count + workers - 1) / workers;
+    std::thread threads[kMaxParallelThreads];
+    size_t spawned = 1;
+    for (; spawned < workers; ++spawned) {
+        const size_t begin = spawned * chunk;
+        const size_t len = std::min(chunk, count - begin);
+        if (len == 0) {
+            break;
+        }
+        try {
+            threads[spawned - 1] = std::thread(fn, begin, len);
+        }
+        catch (...) {
+            break;
+        }
+    }
+    fn(size_t{0}, chunk);
+    // Куски, оставшиеся без потока, доделываем сами
+    for (size_t i = spawned; i < workers; ++i) {
+        const size_t begin = i * chunk;
+        if (begin >= count) {
+            break;
+        }
+        fn(begin, std::min(chunk, count - begin));
+    }
+    for (size_t i = 1; i < spawned; ++i) {
+        threads[i - 1].join();
+    }
+}
+
+// Конструирует n элементов по значению; большие диапазоны nothrow-конструируемых
+// типов инициализируются параллельно по кускам
+template <typename T>
+void ValueConstructN(T* buf, size_t n) {
+    if constexpr (std::is_nothrow_default_constructible_v<T>) {
+        if (n >= 2 * kParallelGrain) {
+            RunChunked(n, [buf](size_t begin, size_t len) {
+                std::uninitialized_value_construct_n(buf + begin, len);
+            });
+            return;
+        }
+    }
+    std::uninitialized_value_construct_n(buf, n);
+}
+
+// Разрушает исходные элементы после RelocateN. Если перенос был побайтовым,
+// ресурсы уже принадлежат новым копиям и деструкторы вызывать нельзя
+template <typename T>
+void DestroyRelocatedN(T* buf, size_t n) noexcept;
+
+// Разрушает n элементов; большие диапазоны с нетривиальным деструктором
+// разрушаются параллельно по кускам
+template <typename T>
+void DestroyN(T* buf, size_t n) noexcept {
+    if constexpr (!std::is_trivially_destructible_v<T>) {
+        if (n >= 2 * kParallelGrain) {
+            RunChunked(n, [buf](size_t begin, size_t len) {
+                std::destroy_n(buf + begin, len);
+            });
+            return;
+        }
+    }
+    std::destroy_n(buf, n);
+}
+
+template <typename T>
+void DestroyRelocatedN(T* buf, size_t n) noexcept {
+    if constexpr (!::kIsTriviallyRelocatable<T>) {
+        DestroyN(buf, n);
+    }
+}
+
+}  // namespace detail
+
+// Метка «сконструировать по умолчанию»: для тривиальных типов элементы
+// остаются неинициализированными вместо заполнения нулями
+struct DefaultInit {};
+inline constexpr DefaultInit kDefaultInit{};
+
+// Политики роста ёмкости. Next получает текущую ёмкость, минимально необходимую
+// и размер элемента в байтах; возвращённое значение не может быть меньше required
+struct GrowthDoubling {
+    static size_t Next(size_t current, size_t required, size_t /*elem_size*/) {
+        return std::max(required, current * 2);
+    }
+};
+
+// Рост в полтора раза: сумма освобождённых блоков успевает дорасти до размера
+// следующего запроса, и аллокатор может их переиспользовать
+struct GrowthOneAndHalf {
+    static size_t Next(size_t current, size_t required, size_t /*elem_size*/) {
+        return std::max(required, current + current / 2);
+    }
+};
+
+// Рост с коэффициентом золотого сечения (~1.618)
+struct GrowthGolden {
+    static size_t Next(size_t current, size_t required, size_t /*elem_size*/) {
+        return std::max(required, current + current * 618 / 1000);
+    }
+};
+
+// Удвоение с округлением ёмкости вверх до целого числа страниц —
+// хвост страницы не пропадает зря
+struct GrowthPageQuantized {
+    static constexpr size_t kPageBytes = 4096;
+
+    static size_t Next(size_t current, size_t required, size_t elem_size) {
+        const size_t grown = std::max(required, current * 2);
+        const size_t bytes = (grown * elem_size + kPageBytes - 1) / kPageBytes * kPageBytes;
+        return std::max(required, bytes / elem_size);
+    }
+};
+
+// Опциональная статистика горячих путей: сборка с -DADVANCED_VECTOR_STATS
+// заводит на каждую инстанциацию Vector счётчики выделений, запрошенных байт,
+// перенесённых элементов и пиковой ёмкости. Реестр обходится через
+// vector_stats::ForEach — по нему видно, какой вектор реаллоцируется без
+// Reserve. Без макроса весь слой исчезает на этапе компиляции
+#if defined(ADVANCED_VECTOR_STATS)
+#include <atomic>
+#include <cstdint>
+#include <typeinfo>
+
+namespace vector_stats {
+
+struct Counters {
+    const char* type_name;
+    size_t elem_size;
+    std::atomic<uint64_t> allocations{0};
+    std::atomic<uint64_t> bytes_requested{0};
+    std::atomic<uint64_t> elements_relocated{0};
+    std::atomic<uint64_t> peak_capacity{0};
+    Counters* next;
+};
+
+inline std::atomic<Counters*>& Head() {
+    static std::atomic<Counters*> head{nullptr};
+    return head;
+}
+
+// Узел живёт до конца процесса: реестр только растёт, по одному узлу на инстанциацию
+inline Counters& Register(const char* type_name, size_t elem_size) {
+    auto* node = new Counters{};
+    node->type_name = type_name;
+    node->elem_size = elem_size;
+    node->next = Head().load(std::memory_order_acquire);
+    while (!Head().compare_exchange_weak(node->next, node, std::memory_order_release)) {
+    }
+    return *node;
+}
+
+template <typename Fn>
+void ForEach(Fn fn) {
+    for (Counters* p = Head().load(std::memory_order_acquire); p != nullptr; p = p->next) {
+        fn(*p);
+    }
+}
+
+}  // namespace vector_stats
+#endif  // ADVANCED_VECTOR_STATS
+
+// Политика обработки исключений при модификации вектора.
+// Strong — классическая строгая гарантия: при исключении контейнер остаётся
+// в исходном состоянии, ради чего бросающие move-конструкторы заменяются
+// копированием, а горячие пути обрастают try/catch.
+// Fast — сборка объявляет конструкторы типа небросающими: все try/catch
+// вырезаются на этапе компиляции и всегда берётся перемещающий путь.
+// Если конструктор всё же бросит, состояние контейнера не определено
+enum class ExceptionPolicy {
+    Strong,
+    Fast,
+};
+
+template <typename T, typename Alloc = std::allocator<T>, typename Growth = GrowthDoubling,
+    ExceptionPolicy Policy = ExceptionPolicy::Strong>
 class Vector {
 public:
+    using AllocTraits = std::allocator_traits<Alloc>;
+
     using iterator = T*;
     using const_iterator = const T*;
 
@@ -109,57 +567,140 @@ public:
 
     Vector() = default;
 
-    explicit Vector(size_t size)
-        :data_(size),
+    explicit Vector(const Alloc& alloc) noexcept
+        :data_(alloc)
+    {
+    }
+
+    explicit Vector(size_t size, const Alloc& alloc = Alloc())
+        :data_(size, alloc),
         size_(size)
 
     {
-        std::uninitialized_value_construct_n(data_.GetAddress(), size);
+        StatsOnAllocate(size);
+        detail::ValueConstructN(data_.GetAddress(), size);
+    }
+
+    Vector(size_t size, DefaultInit, const Alloc& alloc = Alloc())
+        :data_(size, alloc),
+        size_(size)
+
+    {
+        StatsOnAllocate(size);
+        std::uninitialized_default_construct_n(data_.GetAddress(), size);
     }
 
     Vector(const Vector& other)
-        :data_(other.size_),
+        :data_(other.size_, AllocTraits::select_on_container_copy_construction(other.GetAllocator())),
+        size_(other.size_)
+
+    {
+        StatsOnAllocate(other.size_);
+        std::uninitialized_copy_n(other.data_.GetAddress(), other.size_, data_.GetAddress());
+    }
+
+    Vector(const Vector& other, const Alloc& alloc)
+        :data_(other.size_, alloc),
         size_(other.size_)
 
     {
+        StatsOnAllocate(other.size_);
         std::uninitialized_copy_n(other.data_.GetAddress(), other.size_, data_.GetAddress());
     }
 
     Vector(Vector&& other) noexcept
+        :data_(std::move(other.data_)),
+        size_(std::exchange(other.size_, 0))
 
     {
-        Swap(other);
     }
 
-    Vector& operator=(const Vector& rhs) noexcept
+    Vector& operator=(const Vector& rhs)
     {
         if (this != &rhs) {
+            if constexpr (AllocTraits::propagate_on_container_copy_assignment::value) {
+                if (GetAllocator() != rhs.GetAllocator()) {
+                    // Память нужно выделять уже новым аллокатором — строим копию и забираем её буфер
+                    Vector rhs_copy(rhs, rhs.GetAllocator());
+                    ReplaceWith(std::move(rhs_copy));
+                    return *this;
+                }
+            }
             if (data_.Capacity() < rhs.size_) {
-                Vector rhs_copy(rhs);
-                Swap(rhs_copy);
+                Vector rhs_copy(rhs, GetAllocator());
+                ReplaceWith(std::move(rhs_copy));
             }
             else {
+                UnpoisonSpare();
                 std::copy(rhs.data_.GetAddress(), rhs.data_.GetAddress() + std::min(rhs.size_, size_), data_.GetAddress());
-                if (rhs.size_ < size_) {                    
+                if (rhs.size_ < size_) {
                     std::destroy_n(data_.GetAddress() + rhs.size_, size_ - rhs.size_);
                 }
-                else {                   
+                else {
                     std::uninitialized_copy_n(rhs.data_.GetAddress() + size_, rhs.size_ - size_, data_.GetAddress() + size_);
                 }
                 size_ = rhs.size_;
+                PoisonSpare();
             }
         }
         return *this;
     }
 
-    Vector& operator=(Vector&& rhs) noexcept
+    Vector& operator=(Vector&& rhs) noexcept(AllocTraits::propagate_on_container_move_assignment::value
+        || AllocTraits::is_always_equal::value)
     {
         if (this != &rhs) {
-            Swap(rhs);
+            if constexpr (AllocTraits::propagate_on_container_move_assignment::value) {
+                ReplaceWith(std::move(rhs));
+            }
+            else {
+                if (GetAllocator() == rhs.GetAllocator()) {
+                    ReplaceWith(std::move(rhs));
+                }
+                else {
+                    // Буфер чужого аллокатора забирать нельзя — переносим поэлементно в свою память
+                    Vector tmp(GetAllocator());
+                    tmp.data_ = RawMemory<T, Alloc>(rhs.size_, GetAllocator());
+                    std::uninitialized_move_n(rhs.data_.GetAddress(), rhs.size_, tmp.data_.GetAddress());
+                    tmp.size_ = rhs.size_;
+                    ReplaceWith(std::move(tmp));
+                }
+            }
         }
         return *this;
     }
 
+    Alloc GetAllocator() const noexcept
+    {
+        return data_.GetAllocator();
+    }
+
+    // Оборачивает готовый буфер без копирования — так же, как перемещающий
+    // конструктор забирает буфер другого вектора. buf должен быть выделен
+    // совместимо с RawMemory (malloc для тривиально копируемых типов со
+    // стандартным аллокатором, иначе переданным аллокатором), а [0, size)
+    // — содержать сконструированные элементы
+    static Vector Adopt(T* buf, size_t size, size_t capacity, const Alloc& alloc = Alloc()) noexcept
+    {
+        assert(size <= capacity);
+        Vector v(alloc);
+        v.data_.Adopt(buf, capacity);
+        v.size_ = size;
+        v.PoisonSpare();
+        return v;
+    }
+
+    // Отдаёт буфер вызывающему без разрушения элементов; вектор становится пустым.
+    // Освободить буфер обязан новый владелец — тем же способом, каким он был выделен
+    T* Release(size_t& size, size_t& capacity) noexcept
+    {
+        UnpoisonSpare();
+        size = size_;
+        capacity = data_.Capacity();
+        size_ = 0;
+        return data_.Release();
+    }
+
     size_t Size() const noexcept
     {
         return size_;
@@ -186,15 +727,18 @@ public:
         if (new_capacity <= data_.Capacity()) {
             return;
         }
-        RawMemory<T> new_data(new_capacity);
-        if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>) {
-            std::uninitialized_move_n(data_.GetAddress(), size_, new_data.GetAddress());
-        }
-        else {
-            std::uninitialized_copy_n(data_.GetAddress(), size_, new_data.GetAddress());
+        StatsOnAllocate(new_capacity);
+        UnpoisonSpare();
+        if (data_.TryGrow(new_capacity)) {
+            PoisonSpare();
+            return;
         }
-        std::destroy_n(data_.GetAddress(), size_);
+        RawMemory<T, Alloc> new_data(new_capacity, data_.GetAllocator());
+        StatsOnRelocate(size_);
+        detail::RelocateN<kForceMove>(data_.GetAddress(), size_, new_data.GetAddress());
+        detail::DestroyRelocatedN(data_.GetAddress(), size_);
         data_.Swap(new_data);
+        PoisonSpare();
     }
 
     void Swap(Vector& other) noexcept
@@ -203,19 +747,160 @@ public:
         std::swap(size_, other.size_);
     }
 
+    // Переносит элементы в буфер ровно под текущий размер, возвращая излишек памяти
+    void ShrinkToFit()
+    {
+        if (size_ == Capacity()) {
+            return;
+        }
+        if (size_ == 0) {
+            data_ = RawMemory<T, Alloc>(data_.GetAllocator());
+            return;
+        }
+        RawMemory<T, Alloc> new_data(size_, data_.GetAllocator());
+        StatsOnAllocate(size_);
+        StatsOnRelocate(size_);
+        detail::RelocateN<kForceMove>(data_.GetAddress(), size_, new_data.GetAddress());
+        detail::DestroyRelocatedN(data_.GetAddress(), size_);
+        data_.Swap(new_data);
+    }
+
+    // Разрушает элементы и целиком освобождает буфер — вектор становится пустым
+    void ReleaseCapacity() noexcept
+    {
+        detail::DestroyN(data_.GetAddress(), size_);
+        data_ = RawMemory<T, Alloc>(data_.GetAllocator());
+        size_ = 0;
+    }
+
+    // Сбрасывает содержимое в фоновую утилизацию: буфер с элементами уезжает
+    // в отдельный поток, и горячий поток платит O(1) вместо сотен миллисекунд
+    // деструкторов гигантского вектора. Для тривиально разрушаемых типов
+    // деструкторы не нужны вовсе — буфер просто возвращается аллокатору.
+    // Вектор после вызова пуст и готов к переиспользованию
+    void DisposeAsync()
+    {
+        if constexpr (std::is_trivially_destructible_v<T>) {
+            data_ = RawMemory<T, Alloc>(data_.GetAllocator());
+            size_ = 0;
+            return;
+        }
+        else {
+            // Узел выделяется до опустошения вектора: если new бросит,
+            // элементы остаются на месте и будут разрушены как обычно
+            auto* doomed = new RawMemory<T, Alloc>(std::move(data_));
+            const size_t count = std::exchange(size_, 0);
+            data_ = RawMemory<T, Alloc>(doomed->GetAllocator());
+            if (count == 0) {
+                delete doomed;
+                return;
+            }
+            // Лямбда держит только указатель: при сбое запуска потока
+            // владение остаётся здесь и утилизация идёт на месте
+            try {
+                std::thread([doomed, count]() noexcept {
+                    detail::DestroyN(doomed->GetAddress(), count);
+                    delete doomed;
+                }).detach();
+            }
+            catch (...) {
+                detail::DestroyN(doomed->GetAddress(), count);
+                delete doomed;
+            }
+        }
+    }
+
     void Resize(size_t new_size)
     {
         if (new_size < size_) {
-            std::destroy_n(data_.GetAddress() + new_size, size_ - new_size);
+            detail::DestroyN(data_.GetAddress() + new_size, size_ - new_size);
         }
         else {
             if (new_size > Capacity()) {
-                const size_t new_capacity = std::max(new_size, Capacity() * 2);
-                Reserve(new_capacity);
+                Reserve(NextCapacity(new_size));
             }
-            std::uninitialized_value_construct_n(data_.GetAddress() + size_, new_size - size_);
+            UnpoisonSpare();
+            detail::ValueConstructN(data_.GetAddress() + size_, new_size - size_);
         }
         size_ = new_size;
+        PoisonSpare();
+    }
+
+    // Как Resize, но без value-инициализации: новый хвост конструируется по
+    // умолчанию, и для тривиальных типов остаётся неинициализированным —
+    // вызывающий обязан записать его перед чтением
+    void ResizeUninitialized(size_t new_size)
+    {
+        if (new_size < size_) {
+            detail::DestroyN(data_.GetAddress() + new_size, size_ - new_size);
+        }
+        else {
+            if (new_size > Capacity()) {
+                Reserve(NextCapacity(new_size));
+            }
+            UnpoisonSpare();
+            std::uninitialized_default_construct_n(data_.GetAddress() + size_, new_size - size_);
+        }
+        size_ = new_size;
+        PoisonSpare();
+    }
+
+    // Перезаписывает все живые элементы одним значением; размер не меняется
+    void Fill(const T& value) noexcept(std::is_nothrow_copy_assignable_v<T>)
+    {
+        detail::FillN(data_.GetAddress(), size_, value);
+    }
+
+    // Заменяет содержимое count копиями value. Старые элементы не переносятся:
+    // при нехватке ёмкости буфер пересоздаётся и заполняется напрямую
+    void Assign(size_t count, const T& value)
+    {
+        UnpoisonSpare();
+        if (count > Capacity()) {
+            RawMemory<T, Alloc> new_data(NextCapacity(count), data_.GetAllocator());
+            StatsOnAllocate(new_data.Capacity());
+            std::uninitialized_fill_n(new_data.GetAddress(), count, value);
+            detail::DestroyN(data_.GetAddress(), size_);
+            data_.Swap(new_data);
+        }
+        else if (count <= size_) {
+            detail::FillN(data_.GetAddress(), count, value);
+            detail::DestroyN(data_.GetAddress() + count, size_ - count);
+        }
+        else {
+            detail::FillN(data_.GetAddress(), size_, value);
+            std::uninitialized_fill_n(data_.GetAddress() + size_, count - size_, value);
+        }
+        size_ = count;
+        PoisonSpare();
+    }
+
+    // Заменяет содержимое копией диапазона [first, last).
+    // Ограничение по iterator_category отводит целочисленные вызовы к Assign(n, value)
+    template <typename InputIt,
+        typename = typename std::iterator_traits<InputIt>::iterator_category>
+    void Assign(InputIt first, InputIt last)
+    {
+        UnpoisonSpare();
+        const size_t count = std::distance(first, last);
+        if (count > Capacity()) {
+            RawMemory<T, Alloc> new_data(NextCapacity(count), data_.GetAllocator());
+            StatsOnAllocate(new_data.Capacity());
+            std::uninitialized_copy(first, last, new_data.GetAddress());
+            detail::DestroyN(data_.GetAddress(), size_);
+            data_.Swap(new_data);
+        }
+        else if (count <= size_) {
+            std::copy(first, last, data_.GetAddress());
+            detail::DestroyN(data_.GetAddress() + count, size_ - count);
+        }
+        else {
+            const InputIt mid = std::next(first, size_);
+            std::copy(first, mid, data_.GetAddress());
+            std::uninitialized_copy(mid, last, data_.GetAddress() + size_);
+        }
+        size_ = count;
+        PoisonSpare();
     }
 
     void PushBack(const T& value)
@@ -227,7 +912,7 @@ public:
     {
         EmplaceBack(std::move(value));
     }
-    
+
     //Не проходит несколько тестов если я делаю что то вроде такого. В чем может быть проблема?
     /*
     template <typename... Args>
@@ -237,34 +922,119 @@ public:
         return *result;
     }
     */
-    
+
     template <typename... Args>
     T& EmplaceBack(Args&&... args)
     {
         T* result = nullptr;
         if (size_ == Capacity()) {
-            RawMemory<T> new_data(size_ == 0 ? 1 : size_ * 2);
+            RawMemory<T, Alloc> new_data(NextCapacity(size_ + 1), data_.GetAllocator());
+            StatsOnAllocate(new_data.Capacity());
+            StatsOnRelocate(size_);
             result = new(new_data + size_) T(std::forward<Args>(args)...);
-            if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>) {
-                std::uninitialized_move_n(data_.GetAddress(), size_, new_data.GetAddress());
-            }
-            else {
-                std::uninitialized_copy_n(data_.GetAddress(), size_, new_data.GetAddress());
-            }
-            std::destroy_n(data_.GetAddress(), size_);
+            detail::RelocateN<kForceMove>(data_.GetAddress(), size_, new_data.GetAddress());
+            detail::DestroyRelocatedN(data_.GetAddress(), size_);
             data_.Swap(new_data);
         }
         else {
+            UnpoisonSpare();
             result = new(data_ + size_) T(std::forward<Args>(args)...);
         }
         ++size_;
+        PoisonSpare();
         return *result;
     }
 
+    // Незанятый хвост буфера [size_, Capacity()) — под прямую запись recv/read:
+    // ядро заполняет память без временного буфера и без value-инициализации.
+    // Возвращает указатель на начало хвоста и его длину в элементах
+    std::pair<T*, size_t> GetSpareCapacity() noexcept
+    {
+        UnpoisonSpare();
+        return {data_.GetAddress() + size_, Capacity() - size_};
+    }
+
+    // Объявляет count элементов хвоста заполненными после внешней записи.
+    // Только для тривиальных типов: записанные байты и есть готовые объекты
+    void CommitSize(size_t count) noexcept
+    {
+        static_assert(std::is_trivially_copyable_v<T> && std::is_trivially_destructible_v<T>,
+            "Внешняя запись порождает объекты только у тривиальных типов");
+        assert(count <= Capacity() - size_);
+        size_ += count;
+        PoisonSpare();
+    }
+
+    // Дописывает count элементов, беря значения у генератора gen(index).
+    // Ёмкость проверяется один раз, дальше — плотный цикл placement new по
+    // сырому буферу без поэлементной бухгалтерии EmplaceBack.
+    // Возврат генератора — prvalue, он конструируется в слоте без копии
+    template <typename Generator>
+    void EmplaceBackN(size_t count, Generator gen)
+    {
+        if (size_ + count > Capacity()) {
+            Reserve(NextCapacity(size_ + count));
+        }
+        UnpoisonSpare();
+        T* slot = data_.GetAddress() + size_;
+        if constexpr (kForceMove) {
+            for (size_t i = 0; i < count; ++i) {
+                new (slot + i) T(gen(i));
+            }
+        }
+        else {
+            size_t constructed = 0;
+            try {
+                for (; constructed < count; ++constructed) {
+                    new (slot + constructed) T(gen(constructed));
+                }
+            }
+            catch (...) {
+                std::destroy_n(slot, constructed);
+                throw;
+            }
+        }
+        size_ += count;
+        PoisonSpare();
+    }
+
+    // Как EmplaceBackN, но фабрика сама конструирует элемент в переданном
+    // слоте: factory(slot, index) обязана выполнить placement new по slot.
+    // Нужна декодерам, собирающим объект по месту из внешнего буфера
+    template <typename Factory>
+    void AppendFromFactory(size_t count, Factory factory)
+    {
+        if (size_ + count > Capacity()) {
+            Reserve(NextCapacity(size_ + count));
+        }
+        UnpoisonSpare();
+        T* slot = data_.GetAddress() + size_;
+        if constexpr (kForceMove) {
+            for (size_t i = 0; i < count; ++i) {
+                factory(slot + i, i);
+            }
+        }
+        else {
+            size_t constructed = 0;
+            try {
+                for (; constructed < count; ++constructed) {
+                    factory(slot + constructed, constructed);
+                }
+            }
+            catch (...) {
+                std::destroy_n(slot, constructed);
+                throw;
+            }
+        }
+        size_ += count;
+        PoisonSpare();
+    }
+
     void PopBack() noexcept {
         if (size_ > 0) {
             std::destroy_at(data_.GetAddress() + size_ - 1);
             --size_;
+            PoisonSpare();
         }
     }
 
@@ -277,20 +1047,80 @@ iterator Emplace(const_iterator pos, Args&&... args) {
         result = EmplaceWithReallocate(shift,std::forward<Args>(args)...);
     }
     else {
+        UnpoisonSpare();
         result = EmplaceWithoutReallocate(shift, std::forward<Args>(args)...);
     }
     ++size_;
+    PoisonSpare();
     return result;
 }
-    
+
     iterator Erase(const_iterator pos) noexcept
     {
         size_t shift = pos - begin();
-        if (pos >= begin() && pos <= end()) {           
-            std::move(begin() + shift + 1, end(), begin() + shift);
-            PopBack();
-            
+        // Строго меньше end(): для pos == end() сдвиг хвоста ушёл бы в минус
+        if (pos >= begin() && pos < end()) {
+            if constexpr (kIsTriviallyRelocatable<T>) {
+                // Разрушаем удаляемый элемент и сдвигаем хвост одним memmove;
+                // хвост при этом не разрушается — владение переехало вместе с байтами
+                std::destroy_at(begin() + shift);
+                std::memmove(static_cast<void*>(begin() + shift), static_cast<const void*>(begin() + shift + 1),
+                    (size_ - shift - 1) * sizeof(T));
+                --size_;
+                PoisonSpare();
+            }
+            else {
+                std::move(begin() + shift + 1, end(), begin() + shift);
+                PopBack();
+            }
+        }
+        return begin() + shift;
+    }
+
+    // Удаляет диапазон [first, last) одним сдвигом хвоста и одним batched-разрушением
+    iterator Erase(const_iterator first, const_iterator last) noexcept
+    {
+        assert(begin() <= first && first <= last && last <= end());
+        const size_t shift = first - begin();
+        const size_t count = last - first;
+        if (count != 0) {
+            if constexpr (kIsTriviallyRelocatable<T>) {
+                std::destroy_n(begin() + shift, count);
+                std::memmove(static_cast<void*>(begin() + shift), static_cast<const void*>(begin() + shift + count),
+                    (size_ - shift - count) * sizeof(T));
+            }
+            else {
+                std::move(begin() + shift + count, end(), begin() + shift);
+                std::destroy_n(begin() + (size_ - count), count);
+            }
+            size_ -= count;
+            PoisonSpare();
+        }
+        return begin() + shift;
+    }
+
+    // Удаляет все элементы, удовлетворяющие предикату: одна компактация слева
+    // в духе remove_if и одно batched-разрушение хвоста. Возвращает число удалённых
+    template <typename Pred>
+    size_t EraseIf(Pred pred)
+    {
+        iterator new_end = std::remove_if(begin(), end(), pred);
+        const size_t removed = end() - new_end;
+        std::destroy_n(new_end, removed);
+        size_ -= removed;
+        PoisonSpare();
+        return removed;
+    }
+
+    // O(1)-удаление без сохранения порядка: дыру закрывает последний элемент
+    iterator SwapRemove(const_iterator pos) noexcept
+    {
+        assert(pos >= begin() && pos < end());
+        const size_t shift = pos - begin();
+        if (shift + 1 != size_) {
+            data_[shift] = std::move(data_[size_ - 1]);
         }
+        PopBack();
         return begin() + shift;
     }
 
@@ -304,66 +1134,254 @@ iterator Emplace(const_iterator pos, Args&&... args) {
         return Emplace(pos, std::move(value));
     }
 
+    // Дописывает диапазон в конец: ёмкость считается один раз, элементы
+    // конструируются одним проходом без промежуточных реаллокаций
+    template <typename InputIt>
+    void AppendRange(InputIt first, InputIt last)
+    {
+        const size_t count = static_cast<size_t>(std::distance(first, last));
+        if (count == 0) {
+            return;
+        }
+        if (size_ + count > Capacity()) {
+            Reserve(NextCapacity(size_ + count));
+        }
+        UnpoisonSpare();
+        std::uninitialized_copy(first, last, data_.GetAddress() + size_);
+        size_ += count;
+        PoisonSpare();
+    }
+
+    // Вставляет диапазон перед pos, выполняя не более одной реаллокации
+    template <typename InputIt>
+    iterator Insert(const_iterator pos, InputIt first, InputIt last)
+    {
+        assert(pos >= begin() && pos <= end());
+        const size_t shift = pos - begin();
+        const size_t count = static_cast<size_t>(std::distance(first, last));
+        if (count == 0) {
+            return begin() + shift;
+        }
+        if (size_ + count > Capacity()) {
+            InsertRangeWithReallocate(shift, count, first, last);
+        }
+        else {
+            UnpoisonSpare();
+            InsertRangeWithoutReallocate(shift, count, first, last);
+        }
+        PoisonSpare();
+        return begin() + shift;
+    }
+
 
     ~Vector()
     {
-        std::destroy_n(data_.GetAddress(), size_);
+        detail::DestroyN(data_.GetAddress(), size_);
     }
 
 private:
-    static T* Allocate(size_t n)
+    // Новая ёмкость при органическом росте — единая точка применения политики
+    // Fast-политика принудительно берёт перемещающий путь и отключает откаты
+    static constexpr bool kForceMove = Policy == ExceptionPolicy::Fast;
+    static constexpr bool kNothrowRelocate = kForceMove || detail::kIsNothrowRelocatable<T>;
+
+    // Инвариант при ADVANCED_VECTOR_POISON: между мутациями хвост
+    // [size_, Capacity()) отравлен, чтение мимо size_ ловится сразу
+    void PoisonSpare() noexcept
     {
-        return n != 0 ? static_cast<T*>(operator new(n * sizeof(T))) : nullptr;
+#if defined(ADVANCED_VECTOR_POISON)
+        if (Capacity() > size_) {
+            detail::PoisonRegion(static_cast<void*>(data_.GetAddress() + size_),
+                (Capacity() - size_) * sizeof(T));
+        }
+#endif
     }
 
-    static void Deallocate(T* buf) noexcept
+    // Снимает отравление перед законной записью в хвост
+    void UnpoisonSpare() noexcept
     {
-        operator delete(buf);
+#if defined(ADVANCED_VECTOR_POISON)
+        if (Capacity() > size_) {
+            detail::UnpoisonRegion(static_cast<void*>(data_.GetAddress() + size_),
+                (Capacity() - size_) * sizeof(T));
+        }
+#endif
     }
 
+#if defined(ADVANCED_VECTOR_STATS)
+    static vector_stats::Counters& Stats() {
+        static vector_stats::Counters& counters = vector_stats::Register(typeid(T).name(), sizeof(T));
+        return counters;
+    }
+#endif
+
+    static void StatsOnAllocate(size_t capacity) noexcept {
+#if defined(ADVANCED_VECTOR_STATS)
+        if (capacity == 0) {
+            return;
+        }
+        auto& s = Stats();
+        s.allocations.fetch_add(1, std::memory_order_relaxed);
+        s.bytes_requested.fetch_add(capacity * sizeof(T), std::memory_order_relaxed);
+        uint64_t prev = s.peak_capacity.load(std::memory_order_relaxed);
+        while (capacity > prev
+            && !s.peak_capacity.compare_exchange_weak(prev, capacity, std::memory_order_relaxed)) {
+        }
+#else
+        (void)capacity;
+#endif
+    }
 
-    static void CopyConstruct(T* buf, const T& elem)
+    static void StatsOnRelocate(size_t count) noexcept {
+#if defined(ADVANCED_VECTOR_STATS)
+        if (count != 0) {
+            Stats().elements_relocated.fetch_add(count, std::memory_order_relaxed);
+        }
+#else
+        (void)count;
+#endif
+    }
+
+    size_t NextCapacity(size_t required) const {
+        return std::max(required, Growth::Next(Capacity(), required, sizeof(T)));
+    }
+
+    // Уничтожает свои элементы и забирает буфер у rhs вместе с его аллокатором
+    void ReplaceWith(Vector&& rhs) noexcept
     {
-        new (buf) T(elem);
+        detail::DestroyN(data_.GetAddress(), size_);
+        data_ = std::move(rhs.data_);
+        size_ = std::exchange(rhs.size_, 0);
     }
-    
+
 template <typename... Args>
 iterator EmplaceWithReallocate(size_t shift, Args&&... args)
 {
-    RawMemory<T> new_data(size_ == 0 ? 1 : size_ * 2);
+    RawMemory<T, Alloc> new_data(NextCapacity(size_ + 1), data_.GetAllocator());
+    StatsOnAllocate(new_data.Capacity());
+    StatsOnRelocate(size_);
     iterator res = new (new_data + shift) T(std::forward<Args>(args)...);
-    if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>) {
-        std::uninitialized_move_n(data_.GetAddress(), shift, new_data.GetAddress());
-        std::uninitialized_move_n(data_.GetAddress() + shift, size_ - shift, new_data.GetAddress() + shift + 1);
+    if constexpr (kNothrowRelocate) {
+        detail::RelocateN<kForceMove>(data_.GetAddress(), shift, new_data.GetAddress());
+        detail::RelocateN<kForceMove>(data_.GetAddress() + shift, size_ - shift, new_data.GetAddress() + shift + 1);
     }
     else {
         try {
-            std::uninitialized_copy_n(data_.GetAddress(), shift, new_data.GetAddress());
-            std::uninitialized_copy_n(data_.GetAddress() + shift, size_ - shift, new_data.GetAddress() + shift + 1);
+            detail::RelocateN<kForceMove>(data_.GetAddress(), shift, new_data.GetAddress());
+            detail::RelocateN<kForceMove>(data_.GetAddress() + shift, size_ - shift, new_data.GetAddress() + shift + 1);
         }
         catch (...) {
             std::destroy_n(new_data.GetAddress() + shift, 1);
             throw;
         }
     }
-    std::destroy_n(begin(), size_);
+    detail::DestroyRelocatedN(begin(), size_);
     data_.Swap(new_data);
     return res;
 }
 
+template <typename InputIt>
+void InsertRangeWithReallocate(size_t shift, size_t count, InputIt first, InputIt last)
+{
+    RawMemory<T, Alloc> new_data(NextCapacity(size_ + count), data_.GetAllocator());
+    StatsOnAllocate(new_data.Capacity());
+    StatsOnRelocate(size_);
+    // Сначала конструируем новые элементы: при исключении буфер просто освободится
+    std::uninitialized_copy(first, last, new_data.GetAddress() + shift);
+    if constexpr (kNothrowRelocate) {
+        detail::RelocateN<kForceMove>(data_.GetAddress(), shift, new_data.GetAddress());
+        detail::RelocateN<kForceMove>(data_.GetAddress() + shift, size_ - shift, new_data.GetAddress() + shift + count);
+    }
+    else {
+        try {
+            detail::RelocateN<kForceMove>(data_.GetAddress(), shift, new_data.GetAddress());
+            detail::RelocateN<kForceMove>(data_.GetAddress() + shift, size_ - shift, new_data.GetAddress() + shift + count);
+        }
+        catch (...) {
+            std::destroy_n(new_data.GetAddress() + shift, count);
+            throw;
+        }
+    }
+    detail::DestroyRelocatedN(begin(), size_);
+    data_.Swap(new_data);
+    size_ += count;
+}
+
+template <typename InputIt>
+void InsertRangeWithoutReallocate(size_t shift, size_t count, InputIt first, InputIt last)
+{
+    const size_t tail = size_ - shift;
+    if constexpr (kIsTriviallyRelocatable<T>) {
+        // Хвост уезжает одним memmove; при исключении в копировании возвращаем его на место
+        std::memmove(static_cast<void*>(data_.GetAddress() + shift + count),
+            static_cast<const void*>(data_.GetAddress() + shift), tail * sizeof(T));
+        if constexpr (kForceMove) {
+            std::uninitialized_copy(first, last, data_.GetAddress() + shift);
+        }
+        else {
+            try {
+                std::uninitialized_copy(first, last, data_.GetAddress() + shift);
+            }
+            catch (...) {
+                std::memmove(static_cast<void*>(data_.GetAddress() + shift),
+                    static_cast<const void*>(data_.GetAddress() + shift + count), tail * sizeof(T));
+                throw;
+            }
+        }
+        size_ += count;
+        return;
+    }
+    if (count >= tail) {
+        // Весь хвост уезжает в сырую память, диапазон частично конструируется, частично присваивается
+        detail::RelocateN<kForceMove>(data_.GetAddress() + shift, tail, data_.GetAddress() + shift + count);
+        if constexpr (kForceMove) {
+            std::uninitialized_copy(std::next(first, tail), last, data_.GetAddress() + size_);
+        }
+        else {
+            try {
+                std::uninitialized_copy(std::next(first, tail), last, data_.GetAddress() + size_);
+            }
+            catch (...) {
+                std::destroy_n(data_.GetAddress() + shift + count, tail);
+                throw;
+            }
+        }
+        size_ += count;
+        std::copy(first, std::next(first, tail), data_.GetAddress() + shift);
+    }
+    else {
+        detail::RelocateN<kForceMove>(data_.GetAddress() + size_ - count, count, data_.GetAddress() + size_);
+        std::move_backward(begin() + shift, begin() + (size_ - count), begin() + size_);
+        std::copy(first, last, begin() + shift);
+        size_ += count;
+    }
+}
+
 template <typename... Args>
 iterator EmplaceWithoutReallocate(size_t shift, Args&&... args)
 {
-    if (size_ != 0) {
+    if constexpr (std::is_trivially_copyable_v<T>
+        || (kIsTriviallyRelocatable<T> && std::is_nothrow_constructible_v<T, Args...>)) {
+        std::memmove(static_cast<void*>(data_.GetAddress() + shift + 1),
+            static_cast<const void*>(data_.GetAddress() + shift), (size_ - shift) * sizeof(T));
+    }
+    else if (size_ != 0) {
         new (data_ + size_) T(std::move(*(data_.GetAddress() + size_ - 1)));
-        try {
+        if constexpr (kForceMove) {
             std::move_backward(begin() + shift,
                 data_.GetAddress() + size_,
                 data_.GetAddress() + size_ + 1);
         }
-        catch (...) {
-            std::destroy_n(data_.GetAddress() + size_, 1);
-            throw;
+        else {
+            try {
+                std::move_backward(begin() + shift,
+                    data_.GetAddress() + size_,
+                    data_.GetAddress() + size_ + 1);
+            }
+            catch (...) {
+                std::destroy_n(data_.GetAddress() + size_, 1);
+                throw;
+            }
         }
         std::destroy_at(begin() + shift);
     }
@@ -372,6 +1390,10 @@ iterator EmplaceWithoutReallocate(size_t shift, Args&&... args)
 }
 
 
-    RawMemory<T> data_;
+    RawMemory<T, Alloc> data_;
     size_t size_ = 0;
-};
\ No newline at end of file
+};
+
+// Сокращение для векторов с отключённой строгой гарантией исключений
+template <typename T, typename Alloc = std::allocator<T>, typename Growth = GrowthDoubling>
+using FastVector = Vector<T, Alloc, Growth, ExceptionPolicy::Fast>;